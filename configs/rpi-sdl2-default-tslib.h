@@ -179,6 +179,9 @@ extern "C" {
 
   // Enable hardware acceleration
   #define DRV_SDL_RENDER_ACCEL 1
+
+  // Render into a persistent target texture (enables partial redraw)
+  #define DRV_SDL_RENDER_TARGET 1
   
   
   #define GSLC_USE_PROGMEM      0
@@ -0,0 +1,169 @@
+//
+// GUIslice Library Examples
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Example 48 (Arduino): [minimum RAM version]
+//   - Page defined entirely at compile time
+//   - Demonstrates the use of gslc_ElemDefine_P(), gslc_ElemRefInit_P()
+//     and gslc_PageAddStatic(). The elements and the element reference
+//     table are read-only (stored in Flash via PROGMEM where supported),
+//     so only the per-element state flags are kept in RAM.
+//
+// ARDUINO NOTES:
+// - GUIslice_config.h must be edited to match the pinout connections
+//   between the Arduino CPU and the display controller (see ADAGFX_PIN_*).
+//
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+
+// Enumerations for pages, elements, fonts, images
+enum {E_PG_MAIN};
+enum {E_ELEM_BOX,E_ELEM_TITLE,E_ELEM_TXT_COUNT,E_ELEM_BTN_QUIT};
+enum {E_FONT_BTN,E_FONT_TXT,MAX_FONT}; // Use separate enum for fonts, MAX_FONT at end
+
+bool      m_bQuit = false;
+
+// Free-running counter for display
+unsigned  m_nCount = 0;
+
+// Instantiate the GUI
+#define MAX_PAGE                1
+#define MAX_ELEM_PG_MAIN        4     // # Elems total on Main page
+
+gslc_tsGui                  m_gui;
+gslc_tsDriver               m_drv;
+gslc_tsFont                 m_asFont[MAX_FONT];
+gslc_tsPage                 m_asPage[MAX_PAGE];
+gslc_tsElemRef              m_asMainElemRef[MAX_ELEM_PG_MAIN];  // Element state (RAM)
+
+
+#define MAX_STR             8
+
+// Read-only strings are located in Flash if the device supports it
+#if (GSLC_USE_PROGMEM)
+  #define TXT_FLAGS_CONST   (gslc_teTxtFlags)(GSLC_TXT_MEM_PROG | GSLC_TXT_ALLOC_EXT)
+#else
+  #define TXT_FLAGS_CONST   (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT)
+#endif
+#define TXT_FLAGS_RAM       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT)
+
+static const char m_strTitle[] GSLC_PMEM = "GUIslice Static";
+static const char m_strQuit[]  GSLC_PMEM = "Quit";
+static char       m_acCount[MAX_STR] = "????";  // Placeholder for counter
+
+// Define debug message function
+static int16_t DebugOut(char ch) { Serial.write(ch); return 0; }
+
+// Quit button callback
+bool CbBtnQuit(void* pvGui,void *pvElemRef,gslc_teTouch eTouch,int16_t nX,int16_t nY)
+{
+  if (eTouch == GSLC_TOUCH_UP_IN) {
+    m_bQuit = true;
+  }
+  return true;
+}
+
+// -----------------------------------
+// PAGE: MAIN
+
+// Background box
+gslc_ElemDefine_P(m_sElemBox,E_ELEM_BOX,
+  GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_FRAME_EN | GSLC_ELEM_FEA_FILL_EN,
+  GSLC_TYPE_BOX,20,50,280,150,GSLC_GROUP_ID_NONE,
+  (GSLC_COL_WHITE),(GSLC_COL_BLACK),(GSLC_COL_WHITE),(GSLC_COL_BLACK),
+  GSLC_IMGREF_INIT_NONE,GSLC_IMGREF_INIT_NONE,
+  NULL,0,TXT_FLAGS_CONST,(GSLC_COL_WHITE),(GSLC_COL_WHITE),GSLC_ALIGN_MID_MID,0,0,NULL,
+  NULL,NULL,NULL,NULL,NULL);
+
+// Title
+gslc_ElemDefine_P(m_sElemTitle,E_ELEM_TITLE,
+  GSLC_ELEM_FEA_VALID,
+  GSLC_TYPE_TXT,10,10,300,40,GSLC_GROUP_ID_NONE,
+  (GSLC_COL_BLACK),(GSLC_COL_BLACK),(GSLC_COL_BLACK),(GSLC_COL_BLACK),
+  GSLC_IMGREF_INIT_NONE,GSLC_IMGREF_INIT_NONE,
+  (char*)m_strTitle,0,TXT_FLAGS_CONST,(GSLC_COL_WHITE),(GSLC_COL_WHITE),GSLC_ALIGN_MID_MID,0,0,
+  &m_asFont[E_FONT_TXT],
+  NULL,NULL,NULL,NULL,NULL);
+
+// Counter (read-only element, string buffer in RAM)
+gslc_ElemDefine_P(m_sElemCount,E_ELEM_TXT_COUNT,
+  GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_FILL_EN,
+  GSLC_TYPE_TXT,40,60,80,10,GSLC_GROUP_ID_NONE,
+  (GSLC_COL_BLACK),(GSLC_COL_BLACK),(GSLC_COL_BLACK),(GSLC_COL_BLACK),
+  GSLC_IMGREF_INIT_NONE,GSLC_IMGREF_INIT_NONE,
+  m_acCount,MAX_STR,TXT_FLAGS_RAM,(GSLC_COL_YELLOW),(GSLC_COL_YELLOW),GSLC_ALIGN_MID_LEFT,0,0,
+  &m_asFont[E_FONT_TXT],
+  NULL,NULL,NULL,NULL,NULL);
+
+// Quit button with text label
+gslc_ElemDefine_P(m_sElemBtnQuit,E_ELEM_BTN_QUIT,
+  GSLC_ELEM_FEA_VALID | GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |
+  GSLC_ELEM_FEA_FRAME_EN | GSLC_ELEM_FEA_FILL_EN,
+  GSLC_TYPE_BTN,135,140,50,20,GSLC_GROUP_ID_NONE,
+  (GSLC_COL_BLUE_DK2),(GSLC_COL_BLUE_DK4),(GSLC_COL_BLUE_DK2),(GSLC_COL_BLUE_DK1),
+  GSLC_IMGREF_INIT_NONE,GSLC_IMGREF_INIT_NONE,
+  (char*)m_strQuit,0,TXT_FLAGS_CONST,(GSLC_COL_WHITE),(GSLC_COL_WHITE),GSLC_ALIGN_MID_MID,0,0,
+  &m_asFont[E_FONT_BTN],
+  NULL,NULL,NULL,&CbBtnQuit,NULL);
+
+// Element reference table for the page (in drawing order)
+static const gslc_tsElemRef m_asMainElemRefDef[MAX_ELEM_PG_MAIN] GSLC_PMEM = {
+  gslc_ElemRefInit_P(m_sElemBox),
+  gslc_ElemRefInit_P(m_sElemTitle),
+  gslc_ElemRefInit_P(m_sElemCount),
+  gslc_ElemRefInit_P(m_sElemBtnQuit),
+};
+
+
+void setup()
+{
+  // Initialize debug output
+  Serial.begin(9600);
+  gslc_InitDebug(&DebugOut);
+  //delay(1000);  // NOTE: Some devices require a delay after Serial.begin() before serial port can be used
+
+  // Initialize
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { return; }
+
+  // Load Fonts
+  if (!gslc_FontSet(&m_gui,E_FONT_BTN,GSLC_FONTREF_PTR,NULL,1)) { return; }
+  if (!gslc_FontSet(&m_gui,E_FONT_TXT,GSLC_FONTREF_PTR,NULL,1)) { return; }
+
+  // Register the page elements
+  if (!gslc_PageAddStatic(&m_gui,E_PG_MAIN,m_asMainElemRefDef,m_asMainElemRef,MAX_ELEM_PG_MAIN)) { return; }
+
+  // Start up display on main page
+  gslc_SetPageCur(&m_gui,E_PG_MAIN);
+
+  m_bQuit = false;
+}
+
+void loop()
+{
+  char              acTxt[MAX_STR];
+
+  gslc_tsElemRef*  pElemCnt = gslc_PageFindElemById(&m_gui,E_PG_MAIN,E_ELEM_TXT_COUNT);
+
+  m_nCount++;
+
+  // Perform drawing updates
+  snprintf(acTxt,MAX_STR,"%u",m_nCount);
+  gslc_ElemSetTxtStr(&m_gui,pElemCnt,acTxt);
+
+  // Periodically call GUIslice update function
+  gslc_Update(&m_gui);
+
+  // Slow down updates
+  delay(100);
+
+  // In a real program, we would detect the button press and take an action.
+  // For this Arduino demo, we will pretend to exit by emulating it with an
+  // infinite loop. Note that interrupts are not disabled so that any debug
+  // messages via Serial have an opportunity to be transmitted.
+  if (m_bQuit) {
+    gslc_Quit(&m_gui);
+    while (1) { }
+  }
+}
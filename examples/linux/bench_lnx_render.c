@@ -0,0 +1,612 @@
+//
+// GUIslice Library Examples
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// - Rendering benchmark (LINUX):
+//     Renders a set of representative scenes headlessly using the
+//     in-memory framebuffer driver (DRV_DISP_MEM) and reports the
+//     cost of each gslc_PageRedrawGo() call.
+//   - Scenes are based on examples 04, 11, 27, 31, 42 and 43
+//   - Each scene is measured for a fixed number of full-page redraws
+//     and a fixed number of incremental redraws (one or more elements
+//     updated between frames) so that results are repeatable
+//   - Build with: make bench
+//   - Usage:      ./bench_lnx_render [iterations]
+//
+
+#include "GUIslice.h"
+#include "GUIslice_drv.h"
+
+// Include any extended elements
+#include "elem/XCheckbox.h"
+#include "elem/XSlider.h"
+#include "elem/XProgress.h"
+#include "elem/XGraph.h"
+#include "elem/XListbox.h"
+#include "elem/XRingGauge.h"
+#include "elem/XGlowball.h"
+#include "elem/XKeyPad_Alpha.h"
+
+#include <time.h>     // For clock_gettime()
+
+#if !defined(DRV_DISP_MEM)
+  #error "bench_lnx_render requires the in-memory driver (DRV_DISP_MEM)"
+#endif
+
+// Defines for resources
+// - The in-memory driver renders all fonts with its built-in
+//   bitmap font, so the font files are not accessed
+#define FONT1 "/usr/share/fonts/truetype/noto/NotoMono-Regular.ttf"
+
+// Default number of redraws measured per scene and mode
+#define BENCH_ITER_DEF      200
+
+// Enumerations for pages, elements, fonts, images
+enum {E_PG_CTRLS,E_PG_GRAPH,E_PG_LISTBOX,E_PG_RING,E_PG_GLOW,E_PG_ALPHA,E_POP_KEYPAD};
+enum {E_ELEM_PROGRESS=100,E_ELEM_PROGRESS1,E_ELEM_CHECK1,E_ELEM_RADIO1,E_ELEM_RADIO2,
+      E_ELEM_SLIDER,E_ELEM_TXT_COUNT,E_ELEM_TXT_SLIDER,
+      E_ELEM_GRAPH,E_ELEM_SCROLLBAR,
+      E_ELEM_LISTBOX,E_ELEM_LISTSCROLL,E_ELEM_TXT_SEL,
+      E_ELEM_XRING,E_ELEM_XGLOW,
+      E_ELEM_TXT_VAL1,E_ELEM_KEYPAD};
+enum {E_FONT_BTN,E_FONT_TXT,E_FONT_TITLE,E_FONT_LISTBOX,E_FONT_DIAL,MAX_FONT};
+enum {E_GROUP1};
+
+// Instantiate the GUI
+#define MAX_PAGE                7
+
+#define MAX_ELEM_PG_CTRLS       21
+#define MAX_ELEM_PG_GRAPH       9
+#define MAX_ELEM_PG_LISTBOX     10
+#define MAX_ELEM_PG_RING        4
+#define MAX_ELEM_PG_GLOW        4
+#define MAX_ELEM_PG_ALPHA       4
+#define MAX_ELEM_POP_KEYPAD     1
+
+gslc_tsGui                  m_gui;
+gslc_tsDriver               m_drv;
+gslc_tsFont                 m_asFont[MAX_FONT];
+gslc_tsPage                 m_asPage[MAX_PAGE];
+
+gslc_tsElem                 m_asCtrlsElem[MAX_ELEM_PG_CTRLS];
+gslc_tsElemRef              m_asCtrlsElemRef[MAX_ELEM_PG_CTRLS];
+gslc_tsElem                 m_asGraphElem[MAX_ELEM_PG_GRAPH];
+gslc_tsElemRef              m_asGraphElemRef[MAX_ELEM_PG_GRAPH];
+gslc_tsElem                 m_asListboxElem[MAX_ELEM_PG_LISTBOX];
+gslc_tsElemRef              m_asListboxElemRef[MAX_ELEM_PG_LISTBOX];
+gslc_tsElem                 m_asRingElem[MAX_ELEM_PG_RING];
+gslc_tsElemRef              m_asRingElemRef[MAX_ELEM_PG_RING];
+gslc_tsElem                 m_asGlowElem[MAX_ELEM_PG_GLOW];
+gslc_tsElemRef              m_asGlowElemRef[MAX_ELEM_PG_GLOW];
+gslc_tsElem                 m_asAlphaElem[MAX_ELEM_PG_ALPHA];
+gslc_tsElemRef              m_asAlphaElemRef[MAX_ELEM_PG_ALPHA];
+gslc_tsElem                 m_asPopKeypadElem[MAX_ELEM_POP_KEYPAD];
+gslc_tsElemRef              m_asPopKeypadElemRef[MAX_ELEM_POP_KEYPAD];
+
+// Extended element storage
+gslc_tsXProgress            m_sXProgress,m_sXProgress1;
+gslc_tsXCheckbox            m_asXCheck[3];
+gslc_tsXSlider              m_sXSliderCtrls;
+
+#define GRAPH_ROWS          200
+gslc_tsXSlider              m_sXSliderGraph;
+gslc_tsXSlider              m_sXSliderGraphScroll;
+gslc_tsXGraph               m_sGraph;
+int16_t                     m_anGraphBuf[GRAPH_ROWS];
+
+#define COUNTRY_CNT         12
+#define COUNTRY_LEN         15
+gslc_tsXListbox             m_sListbox;
+gslc_tsXSlider              m_sXSliderList;
+uint8_t                     m_acListboxBuf[COUNTRY_CNT*(COUNTRY_LEN+XLISTBOX_BUF_OH_R)];
+
+gslc_tsXRingGauge           m_sXRingGauge;
+gslc_tsXSlider              m_sXSliderRing;
+
+gslc_tsXGlowball            m_sXGlowball;
+gslc_tsXSlider              m_sXSliderGlow;
+
+gslc_tsXKeyPad              m_sKeyPadAlpha;
+
+// Save some element references for quick access
+gslc_tsElemRef*  m_pElemCnt        = NULL;
+gslc_tsElemRef*  m_pElemProgress   = NULL;
+gslc_tsElemRef*  m_pElemProgress1  = NULL;
+gslc_tsElemRef*  m_pElemSlider     = NULL;
+gslc_tsElemRef*  m_pElemSliderTxt  = NULL;
+gslc_tsElemRef*  m_pElemGraph      = NULL;
+gslc_tsElemRef*  m_pElemListbox    = NULL;
+gslc_tsElemRef*  m_pElemListSel    = NULL;
+gslc_tsElemRef*  m_pElemXRingGauge = NULL;
+gslc_tsElemRef*  m_pElemXGlowball  = NULL;
+gslc_tsElemRef*  m_pElemVal1       = NULL;
+gslc_tsElemRef*  m_pElemKeyPad     = NULL;
+
+char m_astrCountries[COUNTRY_CNT][COUNTRY_LEN+1] = {
+  "USA","Brazil","Canada","Denmark","Germany","France",
+  "India","Japan","Mexico","Peru","England","Vietnam"
+};
+
+#define NUM_RINGS 9
+gslc_tsXGlowballRing m_asRings[NUM_RINGS] = {
+  {0,12,(gslc_tsColor) { 138, 0, 255 }},
+  {12,18,(gslc_tsColor) { 0, 12, 255 }},
+  {18,24,(gslc_tsColor) { 0, 96, 255 }},
+  {24,30,(gslc_tsColor) { 0, 198, 255 }},
+  {30,36,(gslc_tsColor) { 0, 255, 150 }},
+  {36,42,(gslc_tsColor) { 33, 217, 0 }},
+  {42,48,(gslc_tsColor) { 255, 234, 0 }},
+  {48,54,(gslc_tsColor) { 255, 152, 0 }},
+  {54,60,(gslc_tsColor) { 255, 0, 0 }}
+};
+
+// Define debug message function
+static int16_t DebugOut(char ch) { fputc(ch,stderr); return 0; }
+
+
+// ------------------------------------------------
+// Scene creation
+// ------------------------------------------------
+
+// Example 04: push buttons, checkboxes, slider and progress bars
+void InitSceneCtrls()
+{
+  gslc_tsElemRef*  pElemRef;
+
+  gslc_PageAdd(&m_gui,E_PG_CTRLS,m_asCtrlsElem,MAX_ELEM_PG_CTRLS,m_asCtrlsElemRef,MAX_ELEM_PG_CTRLS);
+
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){10,50,300,150});
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_WHITE,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  static char mstr_quit[8] = "Quit";
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,
+    (gslc_tsRect){160,80,80,40},mstr_quit,sizeof(mstr_quit),E_FONT_BTN,NULL);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){20,60,50,10},
+    "Count:",0,E_FONT_TXT);
+  pElemRef = gslc_ElemCreateTxt(&m_gui,E_ELEM_TXT_COUNT,E_PG_CTRLS,(gslc_tsRect){80,60,50,10},
+    "",0,E_FONT_TXT);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_YELLOW);
+  m_pElemCnt = pElemRef;
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){20,80,50,10},
+    "Progress:",0,E_FONT_TXT);
+  pElemRef = gslc_ElemXProgressCreate(&m_gui,E_ELEM_PROGRESS,E_PG_CTRLS,&m_sXProgress,
+    (gslc_tsRect){80,80,50,10},0,100,0,GSLC_COL_GREEN,false);
+  m_pElemProgress = pElemRef;
+
+  pElemRef = gslc_ElemXProgressCreate(&m_gui,E_ELEM_PROGRESS1,E_PG_CTRLS,&m_sXProgress1,
+    (gslc_tsRect){280,80,10,100},-25,75,-15,GSLC_COL_RED,true);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_DK3,GSLC_COL_BLACK,GSLC_COL_BLACK);
+  m_pElemProgress1 = pElemRef;
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){20,100,20,20},
+    "Check1:",0,E_FONT_TXT);
+  pElemRef = gslc_ElemXCheckboxCreate(&m_gui,E_ELEM_CHECK1,E_PG_CTRLS,&m_asXCheck[0],
+    (gslc_tsRect){80,100,20,20},false,GSLCX_CHECKBOX_STYLE_X,GSLC_COL_BLUE_LT2,false);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){20,135,20,20},
+    "Radio1:",0,E_FONT_TXT);
+  pElemRef = gslc_ElemXCheckboxCreate(&m_gui,E_ELEM_RADIO1,E_PG_CTRLS,&m_asXCheck[1],
+    (gslc_tsRect){80,135,20,20},true,GSLCX_CHECKBOX_STYLE_ROUND,GSLC_COL_ORANGE,false);
+  gslc_ElemSetGroup(&m_gui,pElemRef,E_GROUP1);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_CTRLS,(gslc_tsRect){20,160,20,20},
+    "Radio2:",0,E_FONT_TXT);
+  pElemRef = gslc_ElemXCheckboxCreate(&m_gui,E_ELEM_RADIO2,E_PG_CTRLS,&m_asXCheck[2],
+    (gslc_tsRect){80,160,20,20},true,GSLCX_CHECKBOX_STYLE_ROUND,GSLC_COL_ORANGE,false);
+  gslc_ElemSetGroup(&m_gui,pElemRef,E_GROUP1);
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,E_ELEM_SLIDER,E_PG_CTRLS,&m_sXSliderCtrls,
+    (gslc_tsRect){160,140,100,20},0,100,60,5,false);
+  gslc_ElemXSliderSetStyle(&m_gui,pElemRef,true,(gslc_tsColor){0,0,128},10,
+          5,(gslc_tsColor){64,64,64});
+  m_pElemSlider = pElemRef;
+  pElemRef = gslc_ElemCreateTxt(&m_gui,E_ELEM_TXT_SLIDER,E_PG_CTRLS,(gslc_tsRect){160,162,80,20},
+    "Slider: ???",0,E_FONT_TXT);
+  m_pElemSliderTxt = pElemRef;
+}
+
+// Example 11: graph with slider and scrollbar
+void InitSceneGraph()
+{
+  gslc_tsElemRef*  pElemRef;
+  uint16_t         nInd;
+
+  gslc_PageAdd(&m_gui,E_PG_GRAPH,m_asGraphElem,MAX_ELEM_PG_GRAPH,m_asGraphElemRef,MAX_ELEM_PG_GRAPH);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,(gslc_tsRect){2,2,320,50},
+    "Graph",0,E_FONT_TITLE);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,(gslc_tsColor){32,32,60});
+  gslc_ElemSetTxtAlign(&m_gui,pElemRef,GSLC_ALIGN_MID_MID);
+  gslc_ElemSetFillEn(&m_gui,pElemRef,false);
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,(gslc_tsRect){0,0,320,50},
+    "Graph",0,E_FONT_TITLE);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,(gslc_tsColor){128,128,240});
+  gslc_ElemSetTxtAlign(&m_gui,pElemRef,GSLC_ALIGN_MID_MID);
+  gslc_ElemSetFillEn(&m_gui,pElemRef,false);
+
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,(gslc_tsRect){10,50,300,180});
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_WHITE,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,&m_sXSliderGraph,
+          (gslc_tsRect){20,60,140,20},0,100,50,5,false);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_GREEN,GSLC_COL_BLACK,GSLC_COL_BLACK);
+  gslc_ElemXSliderSetStyle(&m_gui,pElemRef,true,GSLC_COL_GREEN_DK4,10,5,GSLC_COL_GRAY_DK2);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,(gslc_tsRect){180,60,40,20},
+    "50",0,E_FONT_TXT);
+
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,(gslc_tsRect){18,83,180+3,120+20+3});
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_DK4,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemXGraphCreate(&m_gui,E_ELEM_GRAPH,E_PG_GRAPH,
+    &m_sGraph,(gslc_tsRect){20,85,180,120},E_FONT_TXT,(int16_t*)&m_anGraphBuf,
+        GRAPH_ROWS,GSLC_COL_ORANGE);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_LT2,GSLC_COL_BLACK,GSLC_COL_GRAY_DK3);
+  m_pElemGraph = pElemRef;
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,E_ELEM_SCROLLBAR,E_PG_GRAPH,&m_sXSliderGraphScroll,
+        (gslc_tsRect){20,205,180,20},0,100,100,5,false);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_DK4,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_GRAPH,
+    (gslc_tsRect){250,60,50,30},"QUIT",0,E_FONT_BTN,NULL);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_DK2,GSLC_COL_BLUE_DK4,GSLC_COL_BLUE_DK1);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_WHITE);
+
+  // Insert some initial values into the graph
+  for (nInd=0;nInd<GRAPH_ROWS;nInd++) {
+    gslc_ElemXGraphAdd(&m_gui,m_pElemGraph,nInd/2);
+  }
+}
+
+// Example 31: listbox with scrollbar
+void InitSceneListbox()
+{
+  gslc_tsElemRef*  pElemRef;
+  uint8_t          nInd;
+
+  gslc_PageAdd(&m_gui,E_PG_LISTBOX,m_asListboxElem,MAX_ELEM_PG_LISTBOX,m_asListboxElemRef,MAX_ELEM_PG_LISTBOX);
+
+  gslc_tsRect rList = (gslc_tsRect) { 17, 75, 200, 100 };
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_LISTBOX,rList);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_GRAY,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemXListboxCreate(&m_gui,E_ELEM_LISTBOX,E_PG_LISTBOX,&m_sListbox,
+    (gslc_tsRect){rList.x+2,rList.y+4,rList.w-23,rList.h-7},E_FONT_LISTBOX,
+    m_acListboxBuf,sizeof(m_acListboxBuf),0);
+  gslc_ElemXListboxItemsSetSize(&m_gui,pElemRef,XLISTBOX_SIZE_AUTO,XLISTBOX_SIZE_AUTO);
+  gslc_ElemXListboxSetSize(&m_gui,pElemRef,5,1);
+  gslc_ElemSetFrameEn(&m_gui,pElemRef,true);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_GRAY,GSLC_COL_BLACK,GSLC_COL_BLUE_DK3);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_BLUE_LT3);
+  gslc_ElemSetTxtMarginXY(&m_gui,pElemRef,5,0);
+  gslc_ElemSetGlowCol(&m_gui,pElemRef,GSLC_COL_GRAY,GSLC_COL_BLUE_DK3,GSLC_COL_WHITE);
+  m_pElemListbox = pElemRef;
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,E_ELEM_LISTSCROLL,E_PG_LISTBOX,&m_sXSliderList,
+    (gslc_tsRect){rList.x+rList.w-21,rList.y+4,20,rList.h-8},0,COUNTRY_CNT-1,0,5,true);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_LT1,GSLC_COL_BLACK,GSLC_COL_BLACK);
+  gslc_ElemXSliderSetStyle(&m_gui,pElemRef,true,GSLC_COL_BLUE_DK1,0,0,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_LISTBOX,(gslc_tsRect){15,45,100,25},
+    (char*)"Country:",0,E_FONT_TXT);
+  gslc_ElemSetTxtAlign(&m_gui,pElemRef,GSLC_ALIGN_MID_MID);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_YELLOW);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLACK,GSLC_COL_GRAY_DK3,GSLC_COL_BLACK);
+
+  static char mstr_sel[COUNTRY_LEN+1] = "USA";
+  pElemRef = gslc_ElemCreateTxt(&m_gui,E_ELEM_TXT_SEL,E_PG_LISTBOX,(gslc_tsRect){125,45,80,25},
+    mstr_sel,sizeof(mstr_sel),E_FONT_TXT);
+  gslc_ElemSetTxtAlign(&m_gui,pElemRef,GSLC_ALIGN_MID_MID);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_ORANGE);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLACK,GSLC_COL_GRAY_DK3,GSLC_COL_BLACK);
+  m_pElemListSel = pElemRef;
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_LISTBOX,(gslc_tsRect){10,20,200,25},
+    (char*)"Country Chooser",0,E_FONT_TITLE);
+  gslc_ElemSetTxtAlign(&m_gui,pElemRef,GSLC_ALIGN_MID_MID);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_YELLOW);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLACK,GSLC_COL_GRAY_DK3,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_LISTBOX,
+    (gslc_tsRect){217-60,190,60,30},(char*)"OK",0,E_FONT_TXT,NULL);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_GREEN_DK2,GSLC_COL_GREEN_DK4,GSLC_COL_GREEN_DK1);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_WHITE);
+
+  for (nInd=0;nInd<COUNTRY_CNT;nInd++) {
+    gslc_ElemXListboxAddItem(&m_gui,m_pElemListbox,m_astrCountries[nInd]);
+  }
+}
+
+// Example 42: ring gauge with slider
+void InitSceneRing()
+{
+  gslc_tsElemRef*  pElemRef;
+
+  gslc_PageAdd(&m_gui,E_PG_RING,m_asRingElem,MAX_ELEM_PG_RING,m_asRingElemRef,MAX_ELEM_PG_RING);
+
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_RING,(gslc_tsRect){10,50,300,150});
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_WHITE,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_RING,
+    (gslc_tsRect){235,5,80,30},(char*)"Quit",0,E_FONT_BTN,NULL);
+
+  static char mstr_ring[10] = "";
+  pElemRef = gslc_ElemXRingGaugeCreate(&m_gui,E_ELEM_XRING,E_PG_RING,&m_sXRingGauge,
+    (gslc_tsRect){80,80,100,100},mstr_ring,sizeof(mstr_ring),E_FONT_DIAL);
+  gslc_ElemXRingGaugeSetValRange(&m_gui,pElemRef,0,100);
+  gslc_ElemXRingGaugeSetVal(&m_gui,pElemRef,60);
+  m_pElemXRingGauge = pElemRef;
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,GSLC_ID_AUTO,E_PG_RING,&m_sXSliderRing,
+    (gslc_tsRect){200,80,100,20},0,100,60,5,false);
+  gslc_ElemXSliderSetStyle(&m_gui,pElemRef,true,(gslc_tsColor){0,0,128},10,
+    5,(gslc_tsColor){64,64,64});
+}
+
+// Example 43: glowball with slider
+void InitSceneGlow()
+{
+  gslc_tsElemRef*  pElemRef;
+
+  gslc_PageAdd(&m_gui,E_PG_GLOW,m_asGlowElem,MAX_ELEM_PG_GLOW,m_asGlowElemRef,MAX_ELEM_PG_GLOW);
+
+  pElemRef = gslc_ElemCreateBox(&m_gui,GSLC_ID_AUTO,E_PG_GLOW,(gslc_tsRect){10,50,300,150});
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_WHITE,GSLC_COL_BLACK,GSLC_COL_BLACK);
+
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_GLOW,
+    (gslc_tsRect){235,5,80,30},(char*)"Quit",0,E_FONT_BTN,NULL);
+
+  pElemRef = gslc_ElemXGlowballCreate(&m_gui,E_ELEM_XGLOW,E_PG_GLOW,&m_sXGlowball,
+    120,120,m_asRings,NUM_RINGS);
+  gslc_ElemXGlowballSetColorBack(&m_gui,pElemRef,GSLC_COL_BLACK);
+  gslc_ElemXGlowballSetAngles(&m_gui,pElemRef,0,360);
+  m_pElemXGlowball = pElemRef;
+
+  pElemRef = gslc_ElemXSliderCreate(&m_gui,GSLC_ID_AUTO,E_PG_GLOW,&m_sXSliderGlow,
+    (gslc_tsRect){200,80,100,20},0,9,0,5,false);
+  gslc_ElemXSliderSetStyle(&m_gui,pElemRef,true,(gslc_tsColor){0,0,128},10,
+    5,(gslc_tsColor){64,64,64});
+}
+
+// Example 27: text field with alpha keypad popup
+void InitSceneAlpha()
+{
+  gslc_tsElemRef*  pElemRef;
+
+  gslc_PageAdd(&m_gui,E_PG_ALPHA,m_asAlphaElem,MAX_ELEM_PG_ALPHA,m_asAlphaElemRef,MAX_ELEM_PG_ALPHA);
+  gslc_PageAdd(&m_gui,E_POP_KEYPAD,m_asPopKeypadElem,MAX_ELEM_POP_KEYPAD,m_asPopKeypadElemRef,MAX_ELEM_POP_KEYPAD);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_ALPHA,(gslc_tsRect){90,10,134,32},
+    (char*)"Alpha KeyPad",0,E_FONT_BTN);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_BLUE_LT4);
+
+  pElemRef = gslc_ElemCreateTxt(&m_gui,GSLC_ID_AUTO,E_PG_ALPHA,(gslc_tsRect){20,65,62,17},
+    (char*)"Name:",0,E_FONT_BTN);
+
+  static char mstr_val1[11] = "";
+  pElemRef = gslc_ElemCreateTxt(&m_gui,E_ELEM_TXT_VAL1,E_PG_ALPHA,(gslc_tsRect){90,65,62+10,17},
+    mstr_val1,sizeof(mstr_val1),E_FONT_BTN);
+  gslc_ElemSetCol(&m_gui,pElemRef,GSLC_COL_BLUE_DK1,GSLC_COL_BLACK,GSLC_COL_BLUE_DK4);
+  gslc_ElemSetTxtCol(&m_gui,pElemRef,GSLC_COL_WHITE);
+  gslc_ElemSetFrameEn(&m_gui,pElemRef,true);
+  gslc_ElemSetTxtMargin(&m_gui,pElemRef,5);
+  m_pElemVal1 = pElemRef;
+
+  pElemRef = gslc_ElemCreateBtnTxt(&m_gui,GSLC_ID_AUTO,E_PG_ALPHA,
+    (gslc_tsRect){120,100,80,40},"Quit",0,E_FONT_BTN,NULL);
+
+  static gslc_tsXKeyPadCfg_Alpha sCfg;
+  sCfg = gslc_ElemXKeyPadCfgInit_Alpha();
+  m_pElemKeyPad = gslc_ElemXKeyPadCreate_Alpha(&m_gui,E_ELEM_KEYPAD,E_POP_KEYPAD,
+    &m_sKeyPadAlpha,50,80,E_FONT_BTN,&sCfg);
+}
+
+
+// ------------------------------------------------
+// Scene updates (incremental redraw)
+// - Each update mimics the main loop of the original
+//   example and depends only on the iteration number
+// ------------------------------------------------
+
+void UpdateSceneCtrls(uint32_t nIter)
+{
+  char acTxt[20];
+  int16_t nPos = (int16_t)(nIter % 101);
+  snprintf(acTxt,sizeof(acTxt),"%u",nIter);
+  gslc_ElemSetTxtStr(&m_gui,m_pElemCnt,acTxt);
+  gslc_ElemXProgressSetVal(&m_gui,m_pElemProgress,(int16_t)(nIter % 100));
+  gslc_ElemXSliderSetPos(&m_gui,m_pElemSlider,nPos);
+  snprintf(acTxt,sizeof(acTxt),"Slider: %u",nPos);
+  gslc_ElemSetTxtStr(&m_gui,m_pElemSliderTxt,acTxt);
+  gslc_ElemXProgressSetVal(&m_gui,m_pElemProgress1,(int16_t)(nPos*80/100-15));
+}
+
+void UpdateSceneGraph(uint32_t nIter)
+{
+  gslc_ElemXGraphAdd(&m_gui,m_pElemGraph,(int16_t)((nIter*7) % 100));
+}
+
+void UpdateSceneListbox(uint32_t nIter)
+{
+  int16_t nSel = (int16_t)(nIter % COUNTRY_CNT);
+  gslc_ElemXListboxSetSel(&m_gui,m_pElemListbox,nSel);
+  gslc_ElemSetTxtStr(&m_gui,m_pElemListSel,m_astrCountries[nSel]);
+}
+
+void UpdateSceneRing(uint32_t nIter)
+{
+  char    acTxt[10];
+  int16_t nVal = (int16_t)(nIter % 101);
+  gslc_ElemXRingGaugeSetVal(&m_gui,m_pElemXRingGauge,nVal);
+  snprintf(acTxt,sizeof(acTxt),"%d%%",nVal);
+  gslc_ElemSetTxtStr(&m_gui,m_pElemXRingGauge,acTxt);
+}
+
+void UpdateSceneGlow(uint32_t nIter)
+{
+  gslc_ElemXGlowballSetVal(&m_gui,m_pElemXGlowball,(int16_t)(nIter % 10));
+}
+
+void UpdateSceneAlpha(uint32_t nIter)
+{
+  // Grow the keypad value one character at a time
+  char acTxt[10];
+  uint8_t nLen = (uint8_t)(nIter % 9);
+  memcpy(acTxt,"GUISLICE!",nLen);
+  acTxt[nLen] = '\0';
+  gslc_ElemXKeyPadValSet(&m_gui,m_pElemKeyPad,acTxt);
+}
+
+
+// ------------------------------------------------
+// Benchmark harness
+// ------------------------------------------------
+
+typedef struct {
+  const char*   pName;                  ///< Scene name for report
+  int16_t       nPageId;                ///< Page to display
+  int16_t       nPopupId;               ///< Popup page to show on top (or GSLC_PAGE_NONE)
+  gslc_tsColor  colBkgnd;               ///< Background color
+  void        (*pfuncUpdate)(uint32_t); ///< Incremental update function
+} tsBenchScene;
+
+typedef struct {
+  uint32_t      nFrames;                ///< Number of redraws measured
+  uint64_t      nTimeNs;                ///< Total time within gslc_PageRedrawGo()
+  uint64_t      nTimeMaxNs;             ///< Slowest single redraw
+  uint32_t      nDrawCnt;               ///< Driver draw calls issued
+} tsBenchResult;
+
+tsBenchScene m_asScene[] = {
+  { "ex04_ctrls",     E_PG_CTRLS,   GSLC_PAGE_NONE, GSLC_COL_GRAY_DK2, &UpdateSceneCtrls   },
+  { "ex11_graph",     E_PG_GRAPH,   GSLC_PAGE_NONE, GSLC_COL_GRAY_DK2, &UpdateSceneGraph   },
+  { "ex31_listbox",   E_PG_LISTBOX, GSLC_PAGE_NONE, GSLC_COL_GRAY_DK3, &UpdateSceneListbox },
+  { "ex42_ring",      E_PG_RING,    GSLC_PAGE_NONE, GSLC_COL_GRAY_DK2, &UpdateSceneRing    },
+  { "ex43_glowball",  E_PG_GLOW,    GSLC_PAGE_NONE, GSLC_COL_GRAY_DK2, &UpdateSceneGlow    },
+  { "ex27_alpha",     E_PG_ALPHA,   E_POP_KEYPAD,   GSLC_COL_BLACK,    &UpdateSceneAlpha   },
+};
+#define BENCH_SCENE_CNT (sizeof(m_asScene)/sizeof(m_asScene[0]))
+
+static uint64_t BenchTimeNs()
+{
+  struct timespec sTime;
+  clock_gettime(CLOCK_MONOTONIC,&sTime);
+  return (uint64_t)sTime.tv_sec*1000000000ULL + (uint64_t)sTime.tv_nsec;
+}
+
+// Time a single gslc_PageRedrawGo() call and accumulate the result
+static void BenchRedraw(tsBenchResult* pResult)
+{
+  uint32_t nDrawStart = gslc_DrvMemGetDrawCnt(&m_gui);
+  uint64_t nTimeStart = BenchTimeNs();
+  gslc_PageRedrawGo(&m_gui);
+  uint64_t nTimeDelta = BenchTimeNs() - nTimeStart;
+  pResult->nFrames++;
+  pResult->nTimeNs += nTimeDelta;
+  if (nTimeDelta > pResult->nTimeMaxNs) {
+    pResult->nTimeMaxNs = nTimeDelta;
+  }
+  pResult->nDrawCnt += gslc_DrvMemGetDrawCnt(&m_gui) - nDrawStart;
+}
+
+static void BenchReport(const char* pName,const char* pMode,tsBenchResult* pResult)
+{
+  double fTimeUs = (pResult->nFrames)? (double)pResult->nTimeNs / pResult->nFrames / 1000.0 : 0;
+  double fFps    = (pResult->nTimeNs)? (double)pResult->nFrames * 1e9 / pResult->nTimeNs : 0;
+  printf("%-14s %-5s %7u %10.1f %10.2f %10.2f %10.1f\n",pName,pMode,pResult->nFrames,
+    fFps,fTimeUs,(double)pResult->nTimeMaxNs / 1000.0,
+    (pResult->nFrames)? (double)pResult->nDrawCnt / pResult->nFrames : 0);
+}
+
+static void BenchScene(tsBenchScene* pScene,uint32_t nIterMax)
+{
+  tsBenchResult sFull = {0};
+  tsBenchResult sIncr = {0};
+  uint32_t      nIter;
+
+  gslc_SetBkgndColor(&m_gui,pScene->colBkgnd);
+  gslc_SetPageCur(&m_gui,pScene->nPageId);
+  if (pScene->nPopupId != GSLC_PAGE_NONE) {
+    gslc_PopupShow(&m_gui,pScene->nPopupId,false);
+  }
+
+  // Draw the scene once so that the measurements exclude any
+  // one-time setup performed on the first draw
+  gslc_PageRedrawSet(&m_gui,true);
+  gslc_PageRedrawGo(&m_gui);
+
+  // Full-page redraws
+  for (nIter=0;nIter<nIterMax;nIter++) {
+    gslc_PageRedrawSet(&m_gui,true);
+    BenchRedraw(&sFull);
+  }
+
+  // Incremental redraws
+  for (nIter=0;nIter<nIterMax;nIter++) {
+    (*pScene->pfuncUpdate)(nIter);
+    BenchRedraw(&sIncr);
+  }
+
+  if (pScene->nPopupId != GSLC_PAGE_NONE) {
+    gslc_PopupHide(&m_gui);
+  }
+
+  BenchReport(pScene->pName,"full",&sFull);
+  BenchReport(pScene->pName,"incr",&sIncr);
+}
+
+
+int main( int argc, char* args[] )
+{
+  uint32_t  nIterMax = BENCH_ITER_DEF;
+  uint8_t   nScene;
+
+  if (argc > 1) {
+    nIterMax = (uint32_t)atoi(args[1]);
+    if (nIterMax == 0) {
+      fprintf(stderr,"Usage: %s [iterations]\n",args[0]);
+      exit(1);
+    }
+  }
+
+  // -----------------------------------
+  // Initialize
+  gslc_InitDebug(&DebugOut);
+  if (!gslc_Init(&m_gui,&m_drv,m_asPage,MAX_PAGE,m_asFont,MAX_FONT)) { exit(1); }
+
+  // Load Fonts
+  if (!gslc_FontSet(&m_gui,E_FONT_BTN,GSLC_FONTREF_FNAME,FONT1,12)) { exit(1); }
+  if (!gslc_FontSet(&m_gui,E_FONT_TXT,GSLC_FONTREF_FNAME,FONT1,10)) { exit(1); }
+  if (!gslc_FontSet(&m_gui,E_FONT_TITLE,GSLC_FONTREF_FNAME,FONT1,22)) { exit(1); }
+  if (!gslc_FontSet(&m_gui,E_FONT_LISTBOX,GSLC_FONTREF_FNAME,FONT1,14)) { exit(1); }
+  if (!gslc_FontSet(&m_gui,E_FONT_DIAL,GSLC_FONTREF_FNAME,FONT1,18)) { exit(1); }
+
+  // -----------------------------------
+  // Create the scenes
+  InitSceneCtrls();
+  InitSceneGraph();
+  InitSceneListbox();
+  InitSceneRing();
+  InitSceneGlow();
+  InitSceneAlpha();
+
+  // -----------------------------------
+  // Run the benchmark
+  printf("GUIslice rendering benchmark: %ux%u, %u redraws per mode\n",
+    m_gui.nDispW,m_gui.nDispH,nIterMax);
+  printf("%-14s %-5s %7s %10s %10s %10s %10s\n",
+    "scene","mode","frames","fps","us/redraw","max us","calls/fr");
+  for (nScene=0;nScene<BENCH_SCENE_CNT;nScene++) {
+    BenchScene(&m_asScene[nScene],nIterMax);
+  }
+
+  // -----------------------------------
+  // Close down display
+  gslc_Quit(&m_gui);
+
+  return 0;
+}
@@ -51,6 +51,12 @@
   #include <time.h> // for FrameRate reporting
 #endif
 
+#if defined(GSLC_CFG_LINUX)
+  #include <time.h> // For clock_gettime()
+#else
+  #include <Arduino.h> // For millis(), micros()
+#endif
+
 #if (GSLC_USE_FLOAT)
   #include <math.h>
 #endif
@@ -161,8 +167,8 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
     #endif // !DRV_TOUCH_NONE
 
   #endif
-  // Enable touch input for SDL driver
-  #if defined(DRV_TOUCH_SDL)
+  // Enable touch input for SDL driver and injected touch events
+  #if defined(DRV_TOUCH_SDL) || defined(DRV_TOUCH_MEM)
     pGui->bTouchEn = true;
   #endif
 	
@@ -184,6 +190,56 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
   pGui->bScreenNeedFlip    = false;
 
   gslc_InvalidateRgnReset(pGui);
+  pGui->bRedrawRectEn      = false;
+
+  pGui->nDirtyElemCnt      = 0;
+  pGui->bDirtyElemOvf      = false;
+
+  pGui->nTickCnt           = 0;
+  pGui->bTickOvf           = false;
+
+  #if (GSLC_FEATURE_ELEM_COLD)
+  pGui->nElemColdCnt       = 0;
+  for (nInd=0;nInd<GSLC_ELEM_COLD_MAX;nInd++) {
+    pGui->abElemColdUsed[nInd] = false;
+  }
+  #endif
+
+  #if (GSLC_FEATURE_STYLE)
+  pGui->asStyle            = NULL;
+  pGui->nStyleCnt          = 0;
+  #endif
+
+  #if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+  pGui->pvSaveBuf          = NULL;
+  pGui->nSaveBufSize       = 0;
+  pGui->rSaveRect          = (gslc_tsRect) { 0, 0, 0, 0 };
+  pGui->bSavePend          = false;
+  pGui->bSaveValid         = false;
+  #endif
+
+  #if (GSLC_FEATURE_OCCLUDE)
+  pGui->nOccludeCnt        = 0;
+  pGui->bOccludeValid      = false;
+  pGui->nOccludeStackPage  = GSLC_STACK__MAX;
+  #endif
+
+  #if (GSLC_FEATURE_TXT_DIFF)
+  pGui->bDrawPassEn        = false;
+  pGui->bDrawPassDirty     = false;
+  pGui->nDrawPassDirtyInd  = 0;
+  #endif
+
+  #if (GSLC_USE_PROGMEM)
+  for (nInd = 0; nInd < GSLC_ELEM_PROG_CACHE_MAX; nInd++) {
+    pGui->apElemTmpProgSrc[nInd] = NULL;
+  }
+  pGui->nElemTmpProgNext   = 0;
+  #endif
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  pGui->nHitGridGen        = 0;
+  #endif
 
    // Clear the event-pending struct
   pGui->bEventPending = false;
@@ -257,9 +313,11 @@ bool gslc_Init(gslc_tsGui* pGui,void* pvDriver,gslc_tsPage* asPage,uint8_t nMaxP
 
   #ifdef DBG_FRAME_RATE
   pGui->nFrameRateCnt = 0;
-  pGui->nFrameRateStart = time(NULL);
+  pGui->nFrameRateStart = (uint32_t)time(NULL);
   #endif
 
+  gslc_ResetStats(pGui);
+
   // Initialize the display and touch drivers
   if (bOk) {
     bOk &= gslc_DrvInit(pGui);
@@ -600,9 +658,220 @@ void gslc_Quit(gslc_tsGui* pGui)
 }
 
 
+// Fetch a free-running millisecond timestamp for tick scheduling
+// - Only differences between two timestamps are meaningful
+static uint32_t gslc_TickGetTimeMs()
+{
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sTs;
+  clock_gettime(CLOCK_MONOTONIC,&sTs);
+  return (uint32_t)((uint64_t)sTs.tv_sec * 1000 + (uint64_t)sTs.tv_nsec / 1000000);
+  #else
+  return (uint32_t)millis();
+  #endif
+}
+
+// Determine if tick schedule entry A is due before entry B
+// - The comparison handles wrap of the millisecond timer
+static bool gslc_TickBefore(gslc_tsTick* pTickA,gslc_tsTick* pTickB)
+{
+  return ((int32_t)(pTickA->nTimeDue - pTickB->nTimeDue) < 0);
+}
+
+// Move a tick schedule entry up the heap to restore ordering
+static void gslc_TickSiftUp(gslc_tsGui* pGui,uint8_t nInd)
+{
+  gslc_tsTick sTick = pGui->asTick[nInd];
+  while (nInd > 0) {
+    uint8_t nParent = (nInd-1)/2;
+    if (!gslc_TickBefore(&sTick,&pGui->asTick[nParent])) {
+      break;
+    }
+    pGui->asTick[nInd] = pGui->asTick[nParent];
+    nInd = nParent;
+  }
+  pGui->asTick[nInd] = sTick;
+}
+
+// Move a tick schedule entry down the heap to restore ordering
+// - Only the first nCnt entries are considered part of the heap
+static void gslc_TickSiftDown(gslc_tsGui* pGui,uint8_t nInd,uint8_t nCnt)
+{
+  gslc_tsTick sTick = pGui->asTick[nInd];
+  while (2*nInd+1 < nCnt) {
+    uint8_t nChild = 2*nInd+1;
+    if ((nChild+1 < nCnt) && gslc_TickBefore(&pGui->asTick[nChild+1],&pGui->asTick[nChild])) {
+      nChild++;
+    }
+    if (!gslc_TickBefore(&pGui->asTick[nChild],&sTick)) {
+      break;
+    }
+    pGui->asTick[nInd] = pGui->asTick[nChild];
+    nInd = nChild;
+  }
+  pGui->asTick[nInd] = sTick;
+}
+
+bool gslc_TickAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriod)
+{
+  uint8_t nInd;
+  uint32_t nTimeNow = gslc_TickGetTimeMs();
+
+  // Update the period if the element is already scheduled
+  for (nInd=0;nInd<pGui->nTickCnt;nInd++) {
+    if (pGui->asTick[nInd].pElemRef == pElemRef) {
+      pGui->asTick[nInd].nPeriod = nPeriod;
+      pGui->asTick[nInd].nTimeDue = nTimeNow + nPeriod;
+      gslc_TickSiftUp(pGui,nInd);
+      gslc_TickSiftDown(pGui,nInd,pGui->nTickCnt);
+      return true;
+    }
+  }
+
+  if (pGui->nTickCnt >= GSLC_TICK_MAX) {
+    if (!pGui->bTickOvf) {
+      GSLC_DEBUG2_PRINT("WARNING: TickAdd() too many tick callbacks (max=%d), ticking all elements\n",
+        GSLC_TICK_MAX);
+    }
+    pGui->bTickOvf = true;
+    return false;
+  }
+
+  // The first tick is issued on the next update
+  nInd = pGui->nTickCnt++;
+  pGui->asTick[nInd].pElemRef = pElemRef;
+  pGui->asTick[nInd].nPeriod = nPeriod;
+  pGui->asTick[nInd].nTimeDue = nTimeNow;
+  gslc_TickSiftUp(pGui,nInd);
+  return true;
+}
+
+void gslc_TickRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  uint8_t nInd;
+  for (nInd=0;nInd<pGui->nTickCnt;nInd++) {
+    if (pGui->asTick[nInd].pElemRef == pElemRef) {
+      // Replace the entry with the last one in the heap
+      pGui->nTickCnt--;
+      if (nInd < pGui->nTickCnt) {
+        pGui->asTick[nInd] = pGui->asTick[pGui->nTickCnt];
+        gslc_TickSiftUp(pGui,nInd);
+        gslc_TickSiftDown(pGui,nInd,pGui->nTickCnt);
+      }
+      return;
+    }
+  }
+}
+
+// Add or remove an element from the tick schedule to match
+// whether it has a tick callback
+// - An element that is already scheduled retains its tick period
+static void gslc_ElemTickSync(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bTickEn)
+{
+  if (bTickEn) {
+    uint8_t nInd;
+    for (nInd=0;nInd<pGui->nTickCnt;nInd++) {
+      if (pGui->asTick[nInd].pElemRef == pElemRef) {
+        return;
+      }
+    }
+    gslc_TickAdd(pGui,pElemRef,0);
+  } else {
+    gslc_TickRemove(pGui,pElemRef);
+  }
+}
+
+void gslc_TickDispatch(gslc_tsGui* pGui)
+{
+  uint32_t          nTimeNow = gslc_TickGetTimeMs();
+  uint8_t           nHeapCnt = pGui->nTickCnt;
+  uint8_t           nDueCnt = 0;
+  uint8_t           nInd;
+  gslc_tsElemRef*   apElemRefDue[GSLC_TICK_MAX];
+
+  // Pop all of the entries that are due
+  // - Each popped entry is moved just past the end of the
+  //   shrinking heap, so that it isn't ticked again in this
+  //   update even if its period is 0
+  while ((nHeapCnt > 0) && ((int32_t)(pGui->asTick[0].nTimeDue - nTimeNow) <= 0)) {
+    gslc_tsTick sTick = pGui->asTick[0];
+    apElemRefDue[nDueCnt++] = sTick.pElemRef;
+    nHeapCnt--;
+    pGui->asTick[0] = pGui->asTick[nHeapCnt];
+    pGui->asTick[nHeapCnt] = sTick;
+    gslc_TickSiftDown(pGui,0,nHeapCnt);
+  }
+
+  // Reschedule the entries and return them to the heap
+  // - If the tick has fallen behind by more than a period
+  //   (eg. due to a long redraw), skip the missed ticks
+  //   rather than issuing them in a burst
+  for (nInd=nHeapCnt;nInd<pGui->nTickCnt;nInd++) {
+    gslc_tsTick* pTick = &pGui->asTick[nInd];
+    pTick->nTimeDue += pTick->nPeriod;
+    if ((int32_t)(pTick->nTimeDue - nTimeNow) < 0) {
+      pTick->nTimeDue = nTimeNow + pTick->nPeriod;
+    }
+    gslc_TickSiftUp(pGui,nInd);
+  }
+
+  // Issue the tick events in the order that they were due
+  // - The schedule is consistent at this point, so the
+  //   callbacks are free to change tick functions or periods
+  for (nInd=0;nInd<nDueCnt;nInd++) {
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)apElemRefDue[nInd],NULL);
+    gslc_ElemEvent((void*)pGui,sEvent);
+  }
+}
+
+#if (GSLC_FEATURE_STATS)
+// Fetch a free-running microsecond timestamp for phase timing
+// - Only differences between two timestamps are meaningful
+static uint32_t gslc_StatsGetTimeUs()
+{
+  #if defined(GSLC_CFG_LINUX)
+  struct timespec sTs;
+  clock_gettime(CLOCK_MONOTONIC,&sTs);
+  return (uint32_t)((uint64_t)sTs.tv_sec * 1000000 + (uint64_t)sTs.tv_nsec / 1000);
+  #else
+  return (uint32_t)micros();
+  #endif
+}
+#endif // GSLC_FEATURE_STATS
+
+bool gslc_GetStats(gslc_tsGui* pGui,gslc_tsStats* pStats)
+{
+  if (pStats == NULL) {
+    return false;
+  }
+  #if (GSLC_FEATURE_STATS)
+  *pStats = pGui->sStats;
+  return true;
+  #else
+  (void)pGui; // Unused
+  memset(pStats,0,sizeof(gslc_tsStats));
+  return false;
+  #endif
+}
+
+void gslc_ResetStats(gslc_tsGui* pGui)
+{
+  #if (GSLC_FEATURE_STATS)
+  memset(&pGui->sStats,0,sizeof(gslc_tsStats));
+  #else
+  (void)pGui; // Unused
+  #endif
+}
+
 // Main polling loop for GUIslice
 void gslc_Update(gslc_tsGui* pGui)
 {
+  #if (GSLC_FEATURE_STATS)
+  uint32_t nStatsTimeStart = gslc_StatsGetTimeUs();
+  uint32_t nStatsTimeNow;
+  pGui->sStats.nUpdateCnt++;
+  #endif
+
   // The touch handling logic is used by both the touchscreen
   // handler as well as the GPIO/pin/keyboard input controller
   #if !defined(DRV_TOUCH_NONE)
@@ -610,6 +879,7 @@ void gslc_Update(gslc_tsGui* pGui)
   // Check to see if we had a touch initialization error
   // if so, mark this on the display.
   if (pGui->eInitStatTouch == GSLC_INITSTAT_FAIL) {
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
     gslc_DrvDrawTxt(pGui,5,5,NULL,(char*)"ERROR: InitTouch",
       GSLC_TXT_DEFAULT, GSLC_COL_RED, GSLC_COL_BLACK);
   }
@@ -734,6 +1004,7 @@ void gslc_Update(gslc_tsGui* pGui)
       }
 
       nNumEvts++;
+      GSLC_STATS_INC(pGui,nInputEvtCnt);
     }
 
     // Should we stop handling events?
@@ -744,18 +1015,36 @@ void gslc_Update(gslc_tsGui* pGui)
 
   #endif // !DRV_TOUCH_NONE
 
+  #if (GSLC_FEATURE_STATS)
+  nStatsTimeNow = gslc_StatsGetTimeUs();
+  pGui->sStats.anPhaseUs[GSLC_STAT_PHASE_INPUT] += nStatsTimeNow - nStatsTimeStart;
+  nStatsTimeStart = nStatsTimeNow;
+  #endif
+
   // ---------------------------------------------
 
-  // Issue a timer tick to all pages
+  // Issue a timer tick to the elements that are due
   // - This is independent of the pages in the stack
-  uint8_t nPageInd;
-  gslc_tsPage* pPage = NULL;
-  for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
-    pPage = &pGui->asPage[nPageInd];
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
-    gslc_PageEvent(pGui,sEvent);
+  if (!pGui->bTickOvf) {
+    gslc_TickDispatch(pGui);
+  } else {
+    // Too many tick callbacks to schedule, so issue a
+    // timer tick to all pages
+    uint8_t nPageInd;
+    gslc_tsPage* pPage = NULL;
+    for (nPageInd=0;nPageInd<pGui->nPageCnt;nPageInd++) {
+      pPage = &pGui->asPage[nPageInd];
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_TICK,0,(void*)pPage,NULL);
+      gslc_PageEvent(pGui,sEvent);
+    }
   }
 
+  #if (GSLC_FEATURE_STATS)
+  nStatsTimeNow = gslc_StatsGetTimeUs();
+  pGui->sStats.anPhaseUs[GSLC_STAT_PHASE_TICK] += nStatsTimeNow - nStatsTimeStart;
+  nStatsTimeStart = nStatsTimeNow;
+  #endif
+
   // Perform any redraw required for current page
   // - Only perform the redraw if at least one element
   //   has been marked as requiring redraw
@@ -763,15 +1052,20 @@ void gslc_Update(gslc_tsGui* pGui)
     gslc_PageRedrawGo(pGui);
   }
 
+  #if (GSLC_FEATURE_STATS)
+  nStatsTimeNow = gslc_StatsGetTimeUs();
+  pGui->sStats.anPhaseUs[GSLC_STAT_PHASE_REDRAW] += nStatsTimeNow - nStatsTimeStart;
+  #endif
+
   // Simple "frame" rate reporting
   // - Note that the rate is based on the number of calls to gslc_Update()
   //   per second, which may or may not redraw the frame
   #ifdef DBG_FRAME_RATE
   pGui->nFrameRateCnt++;
-  uint32_t  nElapsed = (time(NULL) - pGui->nFrameRateStart);
+  uint32_t  nElapsed = ((uint32_t)time(NULL) - pGui->nFrameRateStart);
   if (nElapsed > 0) {
     GSLC_DEBUG_PRINT("Update rate: %6u / sec\n",pGui->nFrameRateCnt);
-    pGui->nFrameRateStart = time(NULL);
+    pGui->nFrameRateStart = (uint32_t)time(NULL);
     pGui->nFrameRateCnt = 0;
   }
   #endif
@@ -821,6 +1115,20 @@ bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight)
   }
 }
 
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2)
+{
+  if ((rRect1.w == 0) || (rRect1.h == 0) || (rRect2.w == 0) || (rRect2.h == 0)) {
+    return false;
+  }
+  if ( (rRect2.x > rRect1.x+(int16_t)rRect1.w-1) || (rRect1.x > rRect2.x+(int16_t)rRect2.w-1) ) {
+    return false;
+  }
+  if ( (rRect2.y > rRect1.y+(int16_t)rRect1.h-1) || (rRect1.y > rRect2.y+(int16_t)rRect2.h-1) ) {
+    return false;
+  }
+  return true;
+}
+
 // Ensure the coordinates are increasing from nX0->nX1 and nY0->nY1
 // NOTE: UNUSED
 void gslc_OrderCoord(int16_t* pnX0,int16_t* pnY0,int16_t* pnX1,int16_t* pnY1)
@@ -977,6 +1285,94 @@ gslc_tsImgRef gslc_ResetImage()
   return sImgRef;
 }
 
+#if (GSLC_FEATURE_ELEM_COLD)
+// Fetch the side record of an element, allocating one from
+// the GUI pool if the element doesn't have one yet
+static gslc_tsElemCold* gslc_ElemColdAlloc(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  gslc_tsElemCold* pElemCold;
+  uint16_t          nInd;
+  if (pElem->pElemCold != NULL) {
+    return pElem->pElemCold;
+  }
+  for (nInd=0;nInd<GSLC_ELEM_COLD_MAX;nInd++) {
+    if (!pGui->abElemColdUsed[nInd]) {
+      break;
+    }
+  }
+  if (nInd >= GSLC_ELEM_COLD_MAX) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemColdAlloc() exceeded max (%u), increase GSLC_ELEM_COLD_MAX\n",
+      (unsigned)GSLC_ELEM_COLD_MAX);
+    return NULL;
+  }
+  pGui->abElemColdUsed[nInd] = true;
+  pGui->nElemColdCnt++;
+  pElemCold = &(pGui->asElemCold[nInd]);
+  pElemCold->sImgRefNorm  = gslc_ResetImage();
+  pElemCold->sImgRefGlow  = gslc_ResetImage();
+  pElemCold->pfuncXEvent  = NULL; // UNUSED
+  pElemCold->pfuncXTick   = NULL;
+  pElem->pElemCold = pElemCold;
+  return pElemCold;
+}
+
+// Return the side record of an element to the GUI pool
+// once it no longer holds an image or a tick callback
+static void gslc_ElemColdRelease(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  gslc_tsElemCold* pElemCold = pElem->pElemCold;
+  uint16_t          nInd;
+  if (pElemCold == NULL) {
+    return;
+  }
+  // Side records of constant (_P) elements are not part of the pool
+  for (nInd=0;nInd<GSLC_ELEM_COLD_MAX;nInd++) {
+    if (pElemCold == &(pGui->asElemCold[nInd])) {
+      break;
+    }
+  }
+  if (nInd >= GSLC_ELEM_COLD_MAX) {
+    return;
+  }
+  if ((pElemCold->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) ||
+      (pElemCold->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) ||
+      (pElemCold->pfuncXTick != NULL)) {
+    return;
+  }
+  pGui->abElemColdUsed[nInd] = false;
+  pGui->nElemColdCnt--;
+  pElem->pElemCold = NULL;
+}
+#endif // GSLC_FEATURE_ELEM_COLD
+
+gslc_tsImgRef* gslc_ElemGetImgRef(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow,bool bAlloc)
+{
+#if (GSLC_FEATURE_ELEM_COLD)
+  gslc_tsElemCold* pElemCold = pElem->pElemCold;
+  if ((pElemCold == NULL) && (bAlloc)) {
+    pElemCold = gslc_ElemColdAlloc(pGui,pElem);
+  }
+  if (pElemCold == NULL) {
+    return NULL;
+  }
+  return (bGlow)? &(pElemCold->sImgRefGlow) : &(pElemCold->sImgRefNorm);
+#else
+  (void)pGui; // Unused
+  (void)bAlloc; // Unused
+  return (bGlow)? &(pElem->sImgRefGlow) : &(pElem->sImgRefNorm);
+#endif
+}
+
+// Fetch the tick callback of an element
+static GSLC_CB_TICK gslc_ElemGetTickFuncPtr(gslc_tsElem* pElem)
+{
+#if (GSLC_FEATURE_ELEM_COLD)
+  return (pElem->pElemCold != NULL)? pElem->pElemCold->pfuncXTick : NULL;
+#else
+  return pElem->pfuncXTick;
+#endif
+}
+
 gslc_tsImgRef gslc_GetImageFromFile(const char* pFname,gslc_teImgRefFlags eFmt)
 {
   gslc_tsImgRef sImgRef;
@@ -1194,6 +1590,7 @@ void gslc_DrawSetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_POINT)
   // Call optimized driver point drawing
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_POINT);
   gslc_DrvDrawPoint(pGui,nX,nY,nCol);
 #else
   GSLC_DEBUG2_PRINT("ERROR: Mandatory DrvDrawPoint() is not defined in driver\n");
@@ -1209,7 +1606,9 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
 
 #if (DRV_HAS_DRAW_LINE)
   // Call optimized driver line drawing
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_LINE);
   gslc_DrvDrawLine(pGui,nX0,nY0,nX1,nY1,nCol);
+  gslc_PageFlipSet(pGui,true);
 
 #else
   // Perform Bresenham's line algorithm
@@ -1247,6 +1646,7 @@ void gslc_DrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t
   if (!bDone) {
     for (;;) {
       // Set the pixel
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_POINT);
       gslc_DrvDrawPoint(pGui,nX0,nY0,nCol);
 
       // Calculate next coordinates
@@ -1266,6 +1666,7 @@ void gslc_DrawLineH(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nW,gslc_ts
 {
   uint16_t nOffset;
   for (nOffset=0;nOffset<nW;nOffset++) {
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_POINT);
     gslc_DrvDrawPoint(pGui,nX+nOffset,nY,nCol);
   }
 
@@ -1276,6 +1677,7 @@ void gslc_DrawLineV(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint16_t nH,gslc_ts
 {
   uint16_t nOffset;
   for (nOffset=0;nOffset<nH;nOffset++) {
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_POINT);
     gslc_DrvDrawPoint(pGui,nX,nY+nOffset,nCol);
   }
 
@@ -1304,6 +1706,7 @@ void gslc_DrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_RECT_FRAME)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_FRAME);
   gslc_DrvDrawFrameRect(pGui,rRect,nCol);
 #else
   // Emulate rect frame with four lines
@@ -1331,9 +1734,11 @@ void gslc_DrawFrameRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,
 
 #if (DRV_HAS_DRAW_RECT_ROUND_FRAME)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_ROUND_FRAME);
   gslc_DrvDrawFrameRoundRect(pGui,rRect,nRadius,nCol);
 #else
   // TODO: Add emulation of rounded rects. For now fallback to square corners
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_FRAME);
   gslc_DrvDrawFrameRect(pGui,rRect,nCol);
 #endif
 
@@ -1350,6 +1755,8 @@ void gslc_DrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 
 #if (DRV_HAS_DRAW_RECT_FILL)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_FILL);
+  GSLC_STATS_ADD(pGui,nPixelFill,(uint32_t)rRect.w*rRect.h);
   gslc_DrvDrawFillRect(pGui,rRect,nCol);
 #else
   // Emulate it with individual line draws
@@ -1373,9 +1780,13 @@ void gslc_DrawFillRoundRect(gslc_tsGui* pGui,gslc_tsRect rRect,int16_t nRadius,g
 
 #if (DRV_HAS_DRAW_RECT_ROUND_FILL)
   // Call optimized driver implementation
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_ROUND_FILL);
+  GSLC_STATS_ADD(pGui,nPixelFill,(uint32_t)rRect.w*rRect.h);
   gslc_DrvDrawFillRoundRect(pGui,rRect,nRadius,nCol);
 #else
   // TODO: Add emulation of rounded rects. For now fallback to square corners
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_RECT_FILL);
+  GSLC_STATS_ADD(pGui,nPixelFill,(uint32_t)rRect.w*rRect.h);
   gslc_DrvDrawFillRect(pGui,rRect,nCol);
 #endif
 
@@ -1460,6 +1871,7 @@ void gslc_InvalidateRgnReset(gslc_tsGui* pGui)
 #endif
   pGui->bInvalidateEn = false;
   pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, 1, 1 };
+  pGui->nInvalidateRectCnt = 0;
 }
 
 void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
@@ -1469,6 +1881,9 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui)
 #endif
   pGui->bInvalidateEn = true;
   pGui->rInvalidateRect = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  // The entire screen supersedes any other regions
+  pGui->asInvalidateRect[0] = pGui->rInvalidateRect;
+  pGui->nInvalidateRectCnt = 1;
 }
 
 void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
@@ -1488,12 +1903,77 @@ void gslc_InvalidateRgnPage(gslc_tsGui* pGui, gslc_tsPage* pPage)
 
 void gslc_InvalidateRgnAdd(gslc_tsGui* pGui, gslc_tsRect rAddRect)
 {
+  uint8_t     nInd;
+  uint8_t     nIndBest;
+  uint32_t    nWaste;
+  uint32_t    nWasteBest;
+  gslc_tsRect rUnion;
+  bool        bMerged;
+
+  // Ignore empty regions
+  if ((rAddRect.w == 0) || (rAddRect.h == 0)) {
+    return;
+  }
+
+  // Maintain the overall bounding region
   if (pGui->bInvalidateEn) {
     gslc_UnionRect(&(pGui->rInvalidateRect), rAddRect);
   } else {
     pGui->bInvalidateEn = true;
     pGui->rInvalidateRect = rAddRect;
   }
+
+  // Merge the new rect into the list of invalidated rects
+  // - Any rect in the list that overlaps the new rect (or that
+  //   would cost no more to redraw as part of a single union)
+  //   is absorbed into the new rect and removed from the list.
+  // - As the new rect grows it may reach other rects, so the
+  //   scan is repeated until nothing more is absorbed. This
+  //   keeps the list free of overlapping rects.
+  // - If the list is full, the rect whose union with the new rect
+  //   wastes the least area is absorbed as well.
+  while (1) {
+    do {
+      bMerged = false;
+      for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+        rUnion = rAddRect;
+        gslc_UnionRect(&rUnion,pGui->asInvalidateRect[nInd]);
+        if ( gslc_IsRectOverlap(rAddRect,pGui->asInvalidateRect[nInd]) ||
+             ((uint32_t)rUnion.w * rUnion.h <= (uint32_t)rAddRect.w * rAddRect.h +
+             (uint32_t)pGui->asInvalidateRect[nInd].w * pGui->asInvalidateRect[nInd].h) ) {
+          // Absorb the rect and remove it from the list
+          rAddRect = rUnion;
+          pGui->nInvalidateRectCnt--;
+          pGui->asInvalidateRect[nInd] = pGui->asInvalidateRect[pGui->nInvalidateRectCnt];
+          bMerged = true;
+          break;
+        }
+      }
+    } while (bMerged);
+
+    if (pGui->nInvalidateRectCnt < GSLC_INVALIDATE_RGN_MAX) {
+      break;
+    }
+
+    // The list is full, so pick the cheapest rect to absorb
+    nIndBest = 0;
+    nWasteBest = 0xFFFFFFFF;
+    for (nInd=0;nInd<pGui->nInvalidateRectCnt;nInd++) {
+      rUnion = rAddRect;
+      gslc_UnionRect(&rUnion,pGui->asInvalidateRect[nInd]);
+      nWaste = (uint32_t)rUnion.w * rUnion.h - (uint32_t)rAddRect.w * rAddRect.h
+        - (uint32_t)pGui->asInvalidateRect[nInd].w * pGui->asInvalidateRect[nInd].h;
+      if (nWaste < nWasteBest) {
+        nWasteBest = nWaste;
+        nIndBest = nInd;
+      }
+    }
+    gslc_UnionRect(&rAddRect,pGui->asInvalidateRect[nIndBest]);
+    pGui->nInvalidateRectCnt--;
+    pGui->asInvalidateRect[nIndBest] = pGui->asInvalidateRect[pGui->nInvalidateRectCnt];
+  }
+
+  pGui->asInvalidateRect[pGui->nInvalidateRectCnt++] = rAddRect;
 }
 
 
@@ -1505,6 +1985,7 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 
   #if (DRV_HAS_DRAW_CIRCLE_FRAME)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_CIRCLE_FRAME);
     gslc_DrvDrawFrameCircle(pGui,nMidX,nMidY,nRadius,nCol);
   #else
     // Emulate circle with point drawing
@@ -1525,6 +2006,7 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
         asPt[5] = (gslc_tsPt){nMidX - nY, nMidY - nX};
         asPt[6] = (gslc_tsPt){nMidX + nY, nMidY - nX};
         asPt[7] = (gslc_tsPt){nMidX + nX, nMidY - nY};
+        GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_POINTS);
         gslc_DrvDrawPoints(pGui,asPt,8,nCol);
 
         nY    += 1;
@@ -1539,6 +2021,7 @@ void gslc_DrawFrameCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
     #elif (DRV_HAS_DRAW_POINT)
       while (nX >= nY)
       {
+        GSLC_STATS_ADD(pGui,anDrvCall[GSLC_STAT_DRV_POINT],8);
         gslc_DrvDrawPoint(pGui,nMidX + nX, nMidY + nY,nCol);
         gslc_DrvDrawPoint(pGui,nMidX + nY, nMidY + nX,nCol);
         gslc_DrvDrawPoint(pGui,nMidX - nY, nMidY + nX,nCol);
@@ -1576,6 +2059,7 @@ void gslc_DrawFillCircle(gslc_tsGui* pGui,int16_t nMidX,int16_t nMidY,
 
   #if (DRV_HAS_DRAW_CIRCLE_FILL)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_CIRCLE_FILL);
     gslc_DrvDrawFillCircle(pGui,nMidX,nMidY,nRadius,nCol);
   #else
     // Emulate circle with line drawing
@@ -1629,6 +2113,7 @@ void gslc_DrawFrameTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
   #if (DRV_HAS_DRAW_TRI_FRAME)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TRI_FRAME);
     gslc_DrvDrawFrameTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
   #else
     // Draw triangle with three lines
@@ -1660,6 +2145,7 @@ void gslc_DrawFillTriangle(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,
 
   #if (DRV_HAS_DRAW_TRI_FILL)
     // Call optimized driver implementation
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TRI_FILL);
     gslc_DrvDrawFillTriangle(pGui,nX0,nY0,nX1,nY1,nX2,nY2,nCol);
 
   #else
@@ -2087,6 +2573,11 @@ void gslc_SetStackPage(gslc_tsGui* pGui, uint8_t nStackPos, int16_t nPageId)
   // Save a reference to the selected page
   pGui->apPageStack[nStackPos] = pPage;
 
+  #if (GSLC_FEATURE_OCCLUDE)
+  // The opaque rects used for occlusion need to be recalculated
+  pGui->bOccludeValid = false;
+  #endif
+
   #if defined(DEBUG_LOG)
   GSLC_DEBUG_PRINT("INFO: Changed PageStack[%u] to page %u\n",nStackPos,nPageId);
   #endif
@@ -2149,8 +2640,121 @@ void gslc_SetPageOverlay(gslc_tsGui* pGui,int16_t nPageId)
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
 }
 
+#if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+void gslc_PopupSetSaveBuf(gslc_tsGui* pGui, void* pvBuf, uint32_t nBufSize)
+{
+  pGui->pvSaveBuf    = pvBuf;
+  pGui->nSaveBufSize = (pvBuf == NULL) ? 0 : nBufSize;
+  pGui->bSavePend    = false;
+  pGui->bSaveValid   = false;
+}
+
+// Save the display region that a popup page is about to cover
+// - The saved region only becomes valid once the popup has been
+//   drawn (see gslc_PageRedrawGo)
+static void gslc_PopupSave(gslc_tsGui* pGui, int16_t nPageId)
+{
+  pGui->bSavePend  = false;
+  pGui->bSaveValid = false;
+#if (DRV_HAS_SAVE_RECT)
+  if (pGui->pvSaveBuf == NULL) {
+    return;
+  }
+  // Replacing an existing popup would save the old popup
+  if (pGui->apPageStack[GSLC_STACK_OVERLAY] != NULL) {
+    return;
+  }
+  gslc_tsPage* pPage = gslc_PageFindById(pGui, nPageId);
+  if (pPage == NULL) {
+    return;
+  }
+  gslc_tsRect rSave = pPage->rBounds;
+  gslc_tsRect rDisp = (gslc_tsRect) { 0, 0, pGui->nDispW, pGui->nDispH };
+  if ((rSave.w == 0) || (rSave.h == 0) || (!gslc_ClipRect(&rDisp, &rSave))) {
+    return;
+  }
+  // Complete any pending redraw so that the saved region
+  // matches the current state of the pages
+  if (pGui->bRedrawNeeded) {
+    gslc_PageRedrawGo(pGui);
+  }
+  if (!gslc_DrvSaveRect(pGui, rSave, pGui->pvSaveBuf, pGui->nSaveBufSize)) {
+    return;
+  }
+  pGui->rSaveRect = rSave;
+  pGui->bSavePend = true;
+#else
+  (void)nPageId; // Unused
+#endif // DRV_HAS_SAVE_RECT
+}
+
+// Restore the display region saved under the popup
+// - Returns true if the region was restored, in which case the
+//   pages beneath the popup don't need to be redrawn. Only the
+//   elements on those pages that changed while the popup was
+//   shown are left marked for redraw.
+static bool gslc_PopupRestore(gslc_tsGui* pGui)
+{
+  bool bValid = pGui->bSaveValid;
+  pGui->bSavePend  = false;
+  pGui->bSaveValid = false;
+#if (DRV_HAS_SAVE_RECT)
+  // Skip the restore if a full redraw is pending anyway
+  if ((!bValid) || (gslc_PageRedrawGet(pGui))) {
+    return false;
+  }
+  if (!gslc_DrvRestoreRect(pGui, pGui->rSaveRect, pGui->pvSaveBuf)) {
+    return false;
+  }
+  #if (DRV_HAS_FLIP_RECTS)
+  // Present the restored region now so that the following redraw
+  // can still limit its page flip to its own invalidated regions
+  gslc_DrvPageFlipRects(pGui, &(pGui->rSaveRect), 1);
+  #else
+  gslc_PageFlipSet(pGui, true);
+  #endif
+  pGui->bRedrawNeeded = true;
+
+  // The invalidated regions of elements that were marked while their
+  // page had redraw disabled have since been reset, so mark them again
+  if (pGui->bDirtyElemOvf) {
+    gslc_InvalidateRgnScreen(pGui);
+  } else {
+    uint8_t nDirtyInd;
+    uint8_t nStackPage;
+    uint16_t nInd;
+    for (nDirtyInd = 0; nDirtyInd < pGui->nDirtyElemCnt; nDirtyInd++) {
+      gslc_tsElemRef* pElemRef = pGui->apDirtyElemRef[nDirtyInd];
+      if (!gslc_DirtyElemFind(pGui, pElemRef, &nStackPage, &nInd)) {
+        continue;
+      }
+      if ((nStackPage == GSLC_STACK_OVERLAY) || (!gslc_ElemGetOnScreen(pGui, pElemRef))) {
+        continue;
+      }
+      gslc_tsElem* pElem = gslc_GetElemFromRef(pGui, pElemRef);
+      gslc_InvalidateRgnAdd(pGui, pElem->rElem);
+    }
+  }
+  return true;
+#else
+  (void)bValid; // Unused
+  return false;
+#endif // DRV_HAS_SAVE_RECT
+}
+#endif // GSLC_FEATURE_POPUP_SAVE_UNDER
+
 void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 {
+  #if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+  // Only a modal popup prevents the pages beneath it from drawing
+  // over the region while it is shown
+  if (bModal) {
+    gslc_PopupSave(pGui, nPageId);
+  } else {
+    pGui->bSavePend  = false;
+    pGui->bSaveValid = false;
+  }
+  #endif
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, nPageId);
   // If modal dialog selected, then deactivate other pages in stack
   // If modeless dialog selected, then don't deactivate other pages in stack
@@ -2182,7 +2786,20 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal)
 
 void gslc_PopupHide(gslc_tsGui* pGui)
 {
+  #if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+  if (gslc_PopupRestore(pGui)) {
+    // The region under the popup has already been restored,
+    // so remove the popup without forcing a redraw
+    pGui->apPageStack[GSLC_STACK_OVERLAY] = NULL;
+    #if (GSLC_FEATURE_OCCLUDE)
+    pGui->bOccludeValid = false;
+    #endif
+  } else {
+    gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
+  }
+  #else
   gslc_SetStackPage(pGui, GSLC_STACK_OVERLAY, GSLC_PAGE_NONE);
+  #endif
   // Ensure other pages in stack are activated
   // - This is done in case they were deactivated due to a modal popup
   gslc_SetStackState(pGui, GSLC_STACK_CUR, true, true);
@@ -2232,79 +2849,367 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui)
 // - The typical case for this being required is when an element
 //   requires redraw but it is marked as being transparent. Therefore,
 //   the lower level elements should be redrawn.
-// - For now, just mark the entire page as requiring redraw.
-// TODO: Determine which elements underneath should be redrawn based
-//       on the region exposed by the transparent element.
+// - In this case the page is marked as requiring redraw, but
+//   gslc_PageRedrawGo() limits that redraw to the invalidated
+//   region: the background is clipped to the region and only the
+//   elements (on any page in the stack) that intersect it are drawn.
+// Determine whether an element marked as needing redraw
+// forces a redraw of the entire page
+static bool gslc_PageRedrawCalcElem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+  if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_NONE) {
+    return false;
+  }
+
+  // If partial redraw is supported, then we
+  // look out for transparent elements which may
+  // still warrant full page redraw.
+  if (!pGui->bRedrawPartialEn) {
+    return true;
+  }
+
+  // Is the element transparent?
+  // - If so, the background and any elements underneath it
+  //   must be repainted within the element's region. Since the
+  //   element's rect has already been added to the invalidation
+  //   region, the page redraw will be clipped accordingly.
+  gslc_tsElem* pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  //GSLC_DEBUG2_PRINT("PageRedrawCalc: ID=%u redraw=%u flags_old=%u fea=%u\n",pElem->nId,
+  //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
+  return !(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN);
+}
+
 void gslc_PageRedrawCalc(gslc_tsGui* pGui)
 {
   uint16_t          nInd;
-  int               nStackPage;
-  gslc_tsElem*      pElem = NULL;
+  uint8_t           nStackPage;
   gslc_tsElemRef*   pElemRef = NULL;
   gslc_tsCollect*   pCollect = NULL;
 
   bool  bRedrawFullPage = false;  // Does entire page require redraw?
   gslc_tsPage*  pPage = NULL;
 
-  // Work on each enabled page in the stack
+  if (!pGui->bDirtyElemOvf) {
+    // Only visit the elements that have been marked as needing redraw
+    uint8_t nDirtyInd;
+    for (nDirtyInd=0;nDirtyInd<pGui->nDirtyElemCnt;nDirtyInd++) {
+      pElemRef = pGui->apDirtyElemRef[nDirtyInd];
+      if (!gslc_DirtyElemFind(pGui,pElemRef,&nStackPage,&nInd)) {
+        continue;
+      }
+      if (!pGui->abPageStackDoDraw[nStackPage]) {
+        // If this stack page has redraw disabled, skip full-page redraw check
+        continue;
+      }
+      if (gslc_PageRedrawCalcElem(pGui,pElemRef)) {
+        // Determined that full page needs redraw
+        // so no need to check any more elements
+        bRedrawFullPage = true;
+        break;
+      }
+    }
+  } else {
+
+    // Too many elements were marked to be tracked, so
+    // work on each enabled page in the stack
+    for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+      // Select the page collection to process
+      pPage = pGui->apPageStack[nStackPage];
+      if (!pPage) {
+        // If this stack page is not enabled, skip to next stack page
+        continue;
+      }
+      if (!pGui->abPageStackDoDraw[nStackPage]) {
+        // If this stack page has redraw disabled, skip full-page redraw check
+        continue;
+      }
+      pCollect = &pPage->sCollect;
+
+      for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+        pElemRef = &pCollect->asElemRef[nInd];
+        if (gslc_PageRedrawCalcElem(pGui,pElemRef)) {
+          // Determined that full page needs redraw
+          // so no need to check any more elements
+          bRedrawFullPage = true;
+          break;
+        }
+      }
+
+      if (bRedrawFullPage) {
+        break;
+      }
+    } // nStackPage
+
+  }
+
+  if (bRedrawFullPage) {
+    // Mark the entire screen as requiring redraw
+    gslc_PageRedrawSet(pGui,true);
+  }
+
+}
+
+void gslc_DirtyElemAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if (pGui->bDirtyElemOvf) {
+    // Already falling back to a full scan
+    return;
+  }
+  if (pGui->nDirtyElemCnt >= GSLC_DIRTY_ELEM_MAX) {
+    pGui->bDirtyElemOvf = true;
+    return;
+  }
+  pGui->apDirtyElemRef[pGui->nDirtyElemCnt++] = pElemRef;
+}
+
+bool gslc_DirtyElemFind(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t* pnStackPage,uint16_t* pnElemInd)
+{
+  // Note that the element reference is only compared against
+  // the page collections and never dereferenced here, since
+  // elements in compound element collections (or temporary
+  // references) may also have been marked.
+  uint8_t nStackPage;
   for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
-    // Select the page collection to process
-    pPage = pGui->apPageStack[nStackPage];
+    gslc_tsPage* pPage = pGui->apPageStack[nStackPage];
     if (!pPage) {
-      // If this stack page is not enabled, skip to next stack page
       continue;
     }
-    if (!pGui->abPageStackDoDraw[nStackPage]) {
-      // If this stack page has redraw disabled, skip full-page redraw check
-      continue;
+    gslc_tsCollect* pCollect = &pPage->sCollect;
+    if ((pElemRef >= pCollect->asElemRef) && (pElemRef < pCollect->asElemRef + pCollect->nElemRefCnt)) {
+      *pnStackPage = nStackPage;
+      *pnElemInd = (uint16_t)(pElemRef - pCollect->asElemRef);
+      return true;
+    }
+  }
+  return false;
+}
+
+void gslc_DirtyElemUpdate(gslc_tsGui* pGui)
+{
+  uint8_t           nStackPage;
+  uint16_t          nInd;
+  gslc_tsElemRef*   pElemRef;
+
+  if (!pGui->bDirtyElemOvf) {
+    // Keep the entries that are still pending redraw
+    // - For example, elements on a page in the stack that
+    //   has redraw disabled
+    uint8_t nDirtyInd;
+    uint8_t nDirtyCnt = 0;
+    for (nDirtyInd=0;nDirtyInd<pGui->nDirtyElemCnt;nDirtyInd++) {
+      pElemRef = pGui->apDirtyElemRef[nDirtyInd];
+      if (!gslc_DirtyElemFind(pGui,pElemRef,&nStackPage,&nInd)) {
+        continue;
+      }
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) == GSLC_ELEMREF_REDRAW_NONE) {
+        continue;
+      }
+      // Drop any duplicate entries
+      uint8_t nKeepInd;
+      for (nKeepInd=0;nKeepInd<nDirtyCnt;nKeepInd++) {
+        if (pGui->apDirtyElemRef[nKeepInd] == pElemRef) {
+          break;
+        }
+      }
+      if (nKeepInd == nDirtyCnt) {
+        pGui->apDirtyElemRef[nDirtyCnt++] = pElemRef;
+      }
     }
-    pCollect = &pPage->sCollect;
+    pGui->nDirtyElemCnt = nDirtyCnt;
+    return;
+  }
 
+  // The list overflowed, so rebuild it from the pages in the stack
+  pGui->nDirtyElemCnt = 0;
+  pGui->bDirtyElemOvf = false;
+  for (nStackPage=0;nStackPage<GSLC_STACK__MAX;nStackPage++) {
+    gslc_tsPage* pPage = pGui->apPageStack[nStackPage];
+    if (!pPage) {
+      continue;
+    }
+    gslc_tsCollect* pCollect = &pPage->sCollect;
     for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
       pElemRef = &pCollect->asElemRef[nInd];
-      gslc_teElemRefFlags eFlags = pElemRef->eElemFlags;
+      if ((pElemRef->eElemFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+        gslc_DirtyElemAdd(pGui,pElemRef);
+      }
+    }
+  }
+}
+
+#if (GSLC_FEATURE_OCCLUDE)
+// Collect the rects of opaque elements on the pages above the base
+// of the page stack
+// - An element is treated as opaque if it is visible and either its
+//   draw callback always covers its rect (GSLC_ELEM_FEA_OPAQUE) or it
+//   uses the default drawing with a square fill
+// - Only the GSLC_OCCLUDE_RECT_MAX largest rects are kept
+static void gslc_OccludeCalc(gslc_tsGui* pGui)
+{
+  uint8_t         nStackPage;
+  uint16_t        nInd;
+  uint8_t         nOccludeInd;
+  gslc_tsElemRef* pElemRef;
+  gslc_tsElem*    pElem;
+
+  pGui->nOccludeCnt = 0;
+  for (nStackPage = GSLC_STACK_BASE+1; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+    gslc_tsPage* pPage = pGui->apPageStack[nStackPage];
+    if (!pPage) {
+      continue;
+    }
+    gslc_tsCollect* pCollect = &pPage->sCollect;
+    for (nInd = 0; nInd < pCollect->nElemRefCnt; nInd++) {
+      pElemRef = &pCollect->asElemRef[nInd];
+      if (!gslc_ElemGetVisible(pGui,pElemRef)) {
+        continue;
+      }
       pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      //GSLC_DEBUG2_PRINT("PageRedrawCalc: Ind=%u ID=%u redraw=%u flags_old=%u fea=%u\n",nInd,pElem->nId,
-      //        (eFlags & GSLC_ELEMREF_REDRAW_MASK),eFlags,pElem->nFeatures);
-      if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
-
-        // We found at least one item requiring redraw
-
-        // If partial redraw is supported, then we
-        // look out for transparent elements which may
-        // still warrant full page redraw.
-        if (pGui->bRedrawPartialEn) {
-          // Is the element transparent?
-          // FIXME: Instead of forcing full page redraw, consider
-          // using clipping region for partial redraw
-          if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) {
-            bRedrawFullPage = true;
+      uint16_t nFeatures = pElem->nFeatures;
+      if ((nFeatures & GSLC_ELEM_FEA_OPAQUE) == 0) {
+        if ((pElem->pfuncXDraw != NULL) || ((nFeatures & GSLC_ELEM_FEA_FILL_EN) == 0) ||
+            (nFeatures & GSLC_ELEM_FEA_ROUND_EN)) {
+          continue;
+        }
+      }
+      gslc_tsRect rElem = pElem->rElem;
+      uint32_t nArea = (uint32_t)rElem.w * rElem.h;
+      if (nArea == 0) {
+        continue;
+      }
+      if (pGui->nOccludeCnt < GSLC_OCCLUDE_RECT_MAX) {
+        nOccludeInd = pGui->nOccludeCnt++;
+      } else {
+        // Replace the smallest rect if the new one is larger
+        uint8_t  nMinInd = 0;
+        uint32_t nMinArea = 0xFFFFFFFF;
+        for (nOccludeInd = 0; nOccludeInd < GSLC_OCCLUDE_RECT_MAX; nOccludeInd++) {
+          gslc_tsRect rOcc = pGui->asOccludeRect[nOccludeInd];
+          if ((uint32_t)rOcc.w * rOcc.h < nMinArea) {
+            nMinArea = (uint32_t)rOcc.w * rOcc.h;
+            nMinInd = nOccludeInd;
           }
-        } else {
-          bRedrawFullPage = true;
         }
-
-        if (bRedrawFullPage) {
-          // Determined that full page needs redraw
-          // so no need to check any more elements
-          break;
+        if (nArea <= nMinArea) {
+          continue;
         }
-
+        nOccludeInd = nMinInd;
       }
+      pGui->asOccludeRect[nOccludeInd] = rElem;
+      pGui->anOccludeStack[nOccludeInd] = nStackPage;
+    }
+  }
+  pGui->bOccludeValid = true;
+}
+
+// Determine whether an element on the stack page currently being
+// drawn is entirely covered by an opaque element on a higher page
+static bool gslc_OccludeFind(gslc_tsGui* pGui,gslc_tsRect rElem)
+{
+  uint8_t nOccludeInd;
+  for (nOccludeInd = 0; nOccludeInd < pGui->nOccludeCnt; nOccludeInd++) {
+    if (pGui->anOccludeStack[nOccludeInd] <= pGui->nOccludeStackPage) {
+      continue;
+    }
+    gslc_tsRect rOcc = pGui->asOccludeRect[nOccludeInd];
+    if ((rElem.x >= rOcc.x) && (rElem.y >= rOcc.y) &&
+        (rElem.x + rElem.w <= rOcc.x + rOcc.w) && (rElem.y + rElem.h <= rOcc.y + rOcc.h)) {
+      return true;
     }
+  }
+  return false;
+}
+#endif // GSLC_FEATURE_OCCLUDE
 
-  } // nStackPage
+// Draw the elements that have been marked as needing redraw
+// - Used for a partial page redraw when the dirty list is valid
+// - Elements are drawn in page stack order (bottom page first)
+//   and then in the order they were added to the page, so that
+//   overlapping elements are layered the same way as in a
+//   full page redraw.
+static void gslc_DirtyElemDraw(gslc_tsGui* pGui)
+{
+  uint8_t         nStackPage;
+  uint16_t        nInd;
+  uint8_t         nDirtyInd;
+  uint8_t         nDirtyCnt = pGui->nDirtyElemCnt;
+  uint32_t        anKey[GSLC_DIRTY_ELEM_MAX];
+  gslc_tsElemRef* pElemRef;
+
+  // Sort the entries by stack page and element index
+  // - The list is short, so use an insertion sort
+  for (nDirtyInd=0;nDirtyInd<nDirtyCnt;nDirtyInd++) {
+    pElemRef = pGui->apDirtyElemRef[nDirtyInd];
+    uint32_t nKey = 0xFFFFFFFF;
+    if (gslc_DirtyElemFind(pGui,pElemRef,&nStackPage,&nInd)) {
+      nKey = ((uint32_t)nStackPage << 16) | nInd;
+    }
+    uint8_t nPos = nDirtyInd;
+    while ((nPos > 0) && (anKey[nPos-1] > nKey)) {
+      anKey[nPos] = anKey[nPos-1];
+      pGui->apDirtyElemRef[nPos] = pGui->apDirtyElemRef[nPos-1];
+      nPos--;
+    }
+    anKey[nPos] = nKey;
+    pGui->apDirtyElemRef[nPos] = pElemRef;
+  }
 
-  if (bRedrawFullPage) {
-    // Mark the entire screen as requiring redraw
-    gslc_PageRedrawSet(pGui,true);
+  // Issue the draw events
+  // - Any elements that are marked during the drawing are
+  //   appended to the list and drawn at the end
+  for (nDirtyInd=0;nDirtyInd<pGui->nDirtyElemCnt;nDirtyInd++) {
+    pElemRef = pGui->apDirtyElemRef[nDirtyInd];
+    if (!gslc_DirtyElemFind(pGui,pElemRef,&nStackPage,&nInd)) {
+      continue;
+    }
+    if (!pGui->abPageStackDoDraw[nStackPage]) {
+      continue;
+    }
+    #if (GSLC_FEATURE_OCCLUDE)
+    pGui->nOccludeStackPage = nStackPage;
+    #endif
+    #if (GSLC_FEATURE_TXT_DIFF)
+    pGui->bDrawPassDirty    = true;
+    pGui->nDrawPassDirtyInd = nDirtyInd;
+    #endif
+    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,GSLC_EVTSUB_DRAW_NEEDED,(void*)pElemRef,NULL);
+    gslc_ElemEvent((void*)pGui,sEvent);
   }
+}
+
+#if (GSLC_FEATURE_TXT_DIFF) && (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
+// Determine whether an element drawn earlier in the current
+// redraw pass may have painted over a region
+// - When drawing from the dirty element list, the elements
+//   ahead of the current entry have already been drawn
+// - Otherwise (eg. the list overflowed) the draw order isn't
+//   tracked, so any region may have been painted over
+static bool gslc_DrawPassOverlap(gslc_tsGui* pGui,gslc_tsRect rRect)
+{
+  uint8_t       nDirtyInd;
+  gslc_tsElem*  pElem;
 
+  if (!pGui->bDrawPassEn) {
+    return false;
+  }
+  if (!pGui->bDrawPassDirty) {
+    return true;
+  }
+  for (nDirtyInd=0;nDirtyInd<pGui->nDrawPassDirtyInd;nDirtyInd++) {
+    pElem = gslc_GetElemFromRef(pGui,pGui->apDirtyElemRef[nDirtyInd]);
+    if ((pElem != NULL) && (gslc_IsRectOverlap(pElem->rElem,rRect))) {
+      return true;
+    }
+  }
+  return false;
 }
+#endif // GSLC_FEATURE_TXT_DIFF && DRV_HAS_DRAW_TEXT && !DRV_OVERRIDE_TXT_ALIGN
 
 // Redraw the active page
 // - If the page has been marked as needing redraw, then all
-//   elements are rendered
+//   elements are rendered (restricted to the invalidated region,
+//   if one has been defined)
 // - If the entire page has not been marked as needing redraw then only
 //   the elements that have been marked as needing redraw
 //   are rendered.
@@ -2316,85 +3221,186 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   //   cause other elements to be redrawn as well.
   gslc_PageRedrawCalc(pGui);
 
+  GSLC_STATS_INC(pGui,nRedrawCnt);
+
   // Determine final state of full-screen redraw
   bool  bPageRedraw = gslc_PageRedrawGet(pGui);
 
-  // Set the clipping based on the current invalidated region
-  if (pGui->bInvalidateEn) {
-    #if defined(DBG_REDRAW)
-    // Note that this will still outline the invalidation region
-    // even if we later discover that the changed element is on
-    // a page in the stack that has been disabled through
-    // abPageStackDoDraw[] = false.
-    GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d (%d,%u)-(%d,%d) PageRedraw=%d\n",
-      pGui->bInvalidateEn, pGui->rInvalidateRect.x, pGui->rInvalidateRect.y,
-      pGui->rInvalidateRect.x + pGui->rInvalidateRect.w - 1,
-      pGui->rInvalidateRect.y + pGui->rInvalidateRect.h - 1, bPageRedraw);
-
-    // Mark the invalidation region
-    gslc_DrvDrawFrameRect(pGui, pGui->rInvalidateRect, GSLC_COL_RED);
-
-    // Slow down rendering
-    delay(1000);
-    #endif // DBG_REDRAW
-
-    gslc_SetClipRect(pGui, &(pGui->rInvalidateRect));
+  #if (GSLC_FEATURE_OCCLUDE)
+  if (!pGui->bOccludeValid) {
+    gslc_OccludeCalc(pGui);
   }
-  else {
-    // No invalidation region defined, so default the
-    // clipping region to the entire display
-    gslc_SetClipRect(pGui, NULL);
-  }
-
-  // If a full page redraw is required, then start by
-  // redrawing the background.
-  // NOTE:
-  // - It would be cleaner if we could treat the background
-  //   layer like any other element (and hence check for its
-  //   need-redraw status).
-  // - For now, assume background doesn't need update except
-  //   if the entire page is to be redrawn
-  //   TODO: Fix this assumption (either add specific flag
-  //         for bBkgndNeedRedraw or make the background just
-  //         another element).
+  #endif
+
+  #if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+  // A page redraw draws every page in the stack, so a region saved
+  // under a popup only remains valid across the redraw that first
+  // draws the popup
   if (bPageRedraw) {
-    gslc_DrvDrawBkgnd(pGui);
-    gslc_PageFlipSet(pGui,true);
+    pGui->bSaveValid = pGui->bSavePend;
+    pGui->bSavePend  = false;
   }
+  #endif
+
+  // Determine how many redraw passes are needed
+  // - When the page background is redrawn, each of the invalidated
+  //   rects is redrawn in its own pass (with clipping set to that
+  //   rect) so that the area between distant changes is left alone.
+  //   Elements that don't intersect the pass region are skipped.
+  // - Otherwise, only the elements marked as needing redraw are
+  //   drawn (in their entirety), so a single pass clipped to the
+  //   bounding rect of the invalidated regions is sufficient.
+  uint8_t     nRgnInd;
+  uint8_t     nRgnCnt = 1;
+  gslc_tsRect rRgn = pGui->rInvalidateRect;
+  if ((pGui->bInvalidateEn) && (bPageRedraw) && (pGui->nInvalidateRectCnt > 1)) {
+    nRgnCnt = pGui->nInvalidateRectCnt;
+  }
+
+  #if (DRV_HAS_FLIP_RECTS)
+  // Determine whether the page flip can be limited to the regions
+  // redrawn in the passes below
+  // - If a page flip was already pending, then something was drawn
+  //   outside of the redraw, so the entire screen is flipped
+  gslc_tsRect asFlipRect[GSLC_INVALIDATE_RGN_MAX];
+  uint8_t     nFlipRectCnt = 0;
+  bool        bFlipRects = (pGui->bInvalidateEn) && (!pGui->bScreenNeedFlip);
+  #endif
 
   // Draw other elements (as needed, unless forced page redraw)
   // TODO: Handle GSLC_EVTSUB_DRAW_NEEDED
   uint32_t nSubType = (bPageRedraw)?GSLC_EVTSUB_DRAW_FORCE:GSLC_EVTSUB_DRAW_NEEDED;
   void*    pvData = NULL;
 
-  // TODO: Consider creating a flag that indicates whether any elements
-  // on the page have requested redraw. This would enable us to skip
-  // over this exhaustive search every time we call Update()
+  for (nRgnInd = 0; nRgnInd < nRgnCnt; nRgnInd++) {
 
-  // Issue page redraw events to all pages in stack
-  // - Start from bottom page in stack first
-  for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
-    gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
-    if (!pStackPage) {
-      continue;
+    // Set the clipping based on the current invalidated region
+    if (pGui->bInvalidateEn) {
+      if (nRgnCnt > 1) {
+        rRgn = pGui->asInvalidateRect[nRgnInd];
+      }
+      #if defined(DBG_REDRAW)
+      // Note that this will still outline the invalidation region
+      // even if we later discover that the changed element is on
+      // a page in the stack that has been disabled through
+      // abPageStackDoDraw[] = false.
+      GSLC_DEBUG_PRINT("DBG: PageRedrawGo() InvRgn: En=%d Rgn=%u/%u (%d,%u)-(%d,%d) PageRedraw=%d\n",
+        pGui->bInvalidateEn, nRgnInd+1, nRgnCnt, rRgn.x, rRgn.y,
+        rRgn.x + rRgn.w - 1, rRgn.y + rRgn.h - 1, bPageRedraw);
+
+      // Mark the invalidation region
+      gslc_DrvDrawFrameRect(pGui, rRgn, GSLC_COL_RED);
+
+      // Slow down rendering
+      delay(1000);
+      #endif // DBG_REDRAW
+
+      gslc_SetClipRect(pGui, &rRgn);
+
+      #if (DRV_HAS_FLIP_RECTS)
+      if (bFlipRects) {
+        asFlipRect[nFlipRectCnt++] = rRgn;
+      }
+      #endif
+    }
+    else {
+      // No invalidation region defined, so default the
+      // clipping region to the entire display
+      gslc_SetClipRect(pGui, NULL);
     }
-    if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
-      // When doing a full page redraw, proceed as normal
-      // When only doing a parital page redraw, check to see if
-      // the page has been marked as redraw-disabled. If so, skip
-      // updating the elements on the page.
-      //
-      // The redraw-disabled mode is useful to prevent "show-through"
-      // from dynamically-updating elements in lower layers of the
-      // page stack (this may occur with popup dialogs). If the overlay
-      // page does not overlap dynamically-updating elements, then
-      // DoDraw can be set to true, enabling background updates to occur.
+
+    // Restrict the elements drawn to those within the pass region
+    // - When redrawing the page within an invalidated region, only
+    //   the elements that intersect the region need to be redrawn
+    //   on top of the background. This avoids re-rendering (and then
+    //   clipping) every element on the page when a single
+    //   transparent element has changed.
+    pGui->bRedrawRectEn = (pGui->bInvalidateEn && bPageRedraw);
+    pGui->rRedrawRect = rRgn;
+
+    #if (GSLC_FEATURE_TXT_DIFF)
+    pGui->bDrawPassEn     = true;
+    pGui->bDrawPassDirty  = false;
+    #endif
+
+    // If a full page redraw is required, then start by
+    // redrawing the background.
+    // NOTE:
+    // - It would be cleaner if we could treat the background
+    //   layer like any other element (and hence check for its
+    //   need-redraw status).
+    // - For now, assume background doesn't need update except
+    //   if the entire page is to be redrawn
+    //   TODO: Fix this assumption (either add specific flag
+    //         for bBkgndNeedRedraw or make the background just
+    //         another element).
+    if (bPageRedraw) {
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_BKGND);
+      if (pGui->bInvalidateEn) {
+        GSLC_STATS_ADD(pGui,nPixelFill,(uint32_t)rRgn.w*rRgn.h);
+      } else {
+        GSLC_STATS_ADD(pGui,nPixelFill,(uint32_t)pGui->nDispW*pGui->nDispH);
+      }
+      gslc_DrvDrawBkgnd(pGui);
+      gslc_PageFlipSet(pGui,true);
+    }
+
+    // If only the elements marked as needing redraw are to be
+    // drawn, visit them directly from the dirty element list
+    // rather than searching every element on every page.
+    if ((!bPageRedraw) && (!pGui->bDirtyElemOvf)) {
+      gslc_DirtyElemDraw(pGui);
       continue;
     }
-    pvData = (void*)(pStackPage);
-    gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
-    gslc_PageEvent(pGui,sEvent);
+
+    // Issue page redraw events to all pages in stack
+    // - Start from bottom page in stack first
+    for (int nStackPage = 0; nStackPage < GSLC_STACK__MAX; nStackPage++) {
+      gslc_tsPage* pStackPage = pGui->apPageStack[nStackPage];
+      if (!pStackPage) {
+        continue;
+      }
+      if (!bPageRedraw && !pGui->abPageStackDoDraw[nStackPage]) {
+        // When doing a full page redraw, proceed as normal
+        // When only doing a parital page redraw, check to see if
+        // the page has been marked as redraw-disabled. If so, skip
+        // updating the elements on the page.
+        //
+        // The redraw-disabled mode is useful to prevent "show-through"
+        // from dynamically-updating elements in lower layers of the
+        // page stack (this may occur with popup dialogs). If the overlay
+        // page does not overlap dynamically-updating elements, then
+        // DoDraw can be set to true, enabling background updates to occur.
+        continue;
+      }
+      #if (GSLC_FEATURE_OCCLUDE)
+      pGui->nOccludeStackPage = (uint8_t)nStackPage;
+      #endif
+      pvData = (void*)(pStackPage);
+      gslc_tsEvent sEvent = gslc_EventCreate(pGui,GSLC_EVT_DRAW,nSubType,pvData,NULL);
+      gslc_PageEvent(pGui,sEvent);
+    }
+
+  } // nRgnInd
+
+  pGui->bRedrawRectEn = false;
+  #if (GSLC_FEATURE_OCCLUDE)
+  pGui->nOccludeStackPage = GSLC_STACK__MAX;
+  #endif
+  #if (GSLC_FEATURE_TXT_DIFF)
+  pGui->bDrawPassEn = false;
+  #endif
+
+  #if (DRV_HAS_FLIP_RECTS)
+  // A partial redraw only draws the marked elements, each within
+  // its own invalidated rect, so flip the list of invalidated rects
+  // rather than their bounding rect (which was used for clipping)
+  if ((bFlipRects) && (!bPageRedraw) && (pGui->nInvalidateRectCnt > 0)) {
+    for (nFlipRectCnt = 0; nFlipRectCnt < pGui->nInvalidateRectCnt; nFlipRectCnt++) {
+      asFlipRect[nFlipRectCnt] = pGui->asInvalidateRect[nFlipRectCnt];
+    }
   }
+  #endif
 
 
   // Clear the page redraw flag
@@ -2402,6 +3408,9 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
 
   // Reset the invalidated regions
   gslc_InvalidateRgnReset(pGui);
+
+  // Drop the dirty elements that have now been redrawn
+  gslc_DirtyElemUpdate(pGui);
  
   // Restore the clipping region to the entire display
   gslc_SetClipRect(pGui, NULL);
@@ -2409,9 +3418,16 @@ void gslc_PageRedrawGo(gslc_tsGui* pGui)
   // Clear the "need redraw" flag
   pGui->bRedrawNeeded = false;
 
+  #if (DRV_HAS_FLIP_RECTS)
+  // Page flip only the regions that were redrawn
+  if ((bFlipRects) && (pGui->bScreenNeedFlip)) {
+    gslc_DrvPageFlipRects(pGui,asFlipRect,nFlipRectCnt);
+    gslc_PageFlipSet(pGui,false);
+    return;
+  }
+  #endif
+
   // Page flip the entire screen
-  // - TODO: We could also call Update instead of Flip as that would
-  //         limit the region to refresh.
   gslc_PageFlipGo(pGui);
 
 }
@@ -2554,6 +3570,30 @@ void gslc_SetElemRefFlag(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nFlag
 
 // Returns a pointer to an element from an element reference
 // - Handle caching from FLASH if element is accessed via PROGMEM
+#if (GSLC_USE_PROGMEM)
+// Fetch a RAM copy of an element stored in FLASH
+// - The most recently accessed elements are retained so that
+//   the copy from FLASH can be skipped on repeated accesses
+static gslc_tsElem* gslc_ElemProgCacheGet(gslc_tsGui* pGui,const gslc_tsElem* pElemProg)
+{
+  uint8_t nInd;
+  for (nInd=0;nInd<GSLC_ELEM_PROG_CACHE_MAX;nInd++) {
+    if (pGui->apElemTmpProgSrc[nInd] == pElemProg) {
+      GSLC_STATS_INC(pGui,nElemProgHit);
+      return &pGui->asElemTmpProg[nInd];
+    }
+  }
+
+  // Not cached, so replace the oldest entry
+  GSLC_STATS_INC(pGui,nElemProgMiss);
+  nInd = pGui->nElemTmpProgNext;
+  pGui->nElemTmpProgNext = (nInd+1) % GSLC_ELEM_PROG_CACHE_MAX;
+  memcpy_P(&pGui->asElemTmpProg[nInd],pElemProg,sizeof(gslc_tsElem));
+  pGui->apElemTmpProgSrc[nInd] = pElemProg;
+  return &pGui->asElemTmpProg[nInd];
+}
+#endif // GSLC_USE_PROGMEM
+
 gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
 {
   if (!pElemRef) {
@@ -2571,15 +3611,11 @@ gslc_tsElem* gslc_GetElemFromRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   //       below.
 
   // If the element is in FLASH and requires PROGMEM to access
-  // then cache it locally and return a pointer to the global
-  // temporary element instead so that further accesses can
-  // be direct.
+  // then cache it locally and return a pointer to the cached
+  // copy instead so that further accesses can be direct.
   if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_PROG) {
-    // TODO: Optimize by checking to see if we already cached this element
-    // - Can probably do this by comparing the bValid and nId
     #if (GSLC_USE_PROGMEM)
-    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
-    pElem = &pGui->sElemTmpProg;
+    pElem = gslc_ElemProgCacheGet(pGui,pElem);
     #endif
   } else if ((eFlags & GSLC_ELEMREF_SRC) == GSLC_ELEMREF_SRC_CONST) {
     // We are running on device that may support FLASH storage
@@ -2886,6 +3922,24 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       pElemRef = (gslc_tsElemRef*)(pvScope);
       pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
 
+      // Skip elements outside of the current redraw pass region
+      // - See the multi-region handling in gslc_PageRedrawGo()
+      if ((pElem) && (pGui->bRedrawRectEn) && (!gslc_IsRectOverlap(pElem->rElem,pGui->rRedrawRect))) {
+        return true;
+      }
+
+      #if (GSLC_FEATURE_OCCLUDE)
+      // Skip elements hidden beneath an opaque element on a higher
+      // page in the stack. The element is no longer visible, so any
+      // pending redraw is dropped; it is redrawn in full when the
+      // covering page is removed.
+      if ((pElem) && (pGui->nOccludeStackPage < GSLC_STACK__MAX) && (gslc_OccludeFind(pGui,pElem->rElem))) {
+        GSLC_STATS_INC(pGui,nElemOcclude);
+        gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+        return true;
+      }
+      #endif
+
       // Determine if redraw is needed
       gslc_teRedrawType eRedraw = gslc_ElemGetRedraw(pGui,pElemRef);
 
@@ -2953,10 +4007,11 @@ bool gslc_ElemEvent(void* pvGui,gslc_tsEvent sEvent)
       // Since we are going to use the callback within the element
       // we need to ensure it is cached in RAM first
       pElem = gslc_GetElemFromRef(pGui,pElemRef);
-      pfuncXTick = pElem->pfuncXTick;
+      pfuncXTick = gslc_ElemGetTickFuncPtr(pElem);
 
       // Invoke the callback function
       if (pfuncXTick != NULL) {
+        GSLC_STATS_INC(pGui,nTickEvtCnt);
         // TODO: Confirm that tick functions want pvScope
         (*pfuncXTick)(pvGui,(void*)(pElemRef));
         return true;
@@ -2985,8 +4040,29 @@ void gslc_ElemDraw(gslc_tsGui* pGui,int16_t nPageId,int16_t nElemId)
   gslc_ElemEvent(pGui,sEvent);
 }
 
-void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
-  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+// Discard any cached measurements of an element's text
+// - Called whenever the text string, font or text mode changes
+// - Read-only elements never hold a cache, so they are left untouched
+void gslc_ElemTxtCacheReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
+{
+  if ((pElemRef == NULL) || ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM)) {
+    return;
+  }
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  pElem->sTxtSize.bValid  = false;
+#endif
+#if (GSLC_FEATURE_TXT_WRAP)
+  pElem->bTxtLineValid    = false;
+#endif
+}
+
+#if (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
+// Calculate the top-left position of a block of text with
+// the requested alignment within a region
+static void gslc_CalcTxtAlign(gslc_tsRect rTxt,int8_t eTxtAlign,int16_t nMarginW,int16_t nMarginH,
+  uint16_t nTxtSzW,uint16_t nTxtSzH,int16_t* pnTxtX,int16_t* pnTxtY)
 {
   int16_t   nElemX,nElemY;
   uint16_t  nElemW,nElemH;
@@ -2996,6 +4072,251 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
   nElemW    = rTxt.w;
   nElemH    = rTxt.h;
 
+  // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
+  if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { *pnTxtX = nElemX+nMarginW; }
+  else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { *pnTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
+  else                                       { *pnTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
+
+  // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
+  if      (eTxtAlign & GSLC_ALIGNV_TOP)      { *pnTxtY = nElemY+nMarginH; }
+  else if (eTxtAlign & GSLC_ALIGNV_BOT)      { *pnTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
+  else                                       { *pnTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
+}
+
+// Calculate the placement of a text string aligned within a region
+// - If pElem is provided, the element's cached text dimensions
+//   may be used in place of a query to the driver
+// - prTxtBox returns the bounds of the rendered text. The text is
+//   drawn by the driver at (x-nTxtOffsetX, y-nTxtOffsetY).
+static void gslc_CalcTxtBox(gslc_tsGui* pGui,gslc_tsElem* pElem,char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,
+  gslc_teTxtFlags eTxtFlags,int8_t eTxtAlign,int16_t nMarginW,int16_t nMarginH,
+  gslc_tsRect* prTxtBox,int16_t* pnTxtOffsetX,int16_t* pnTxtOffsetY)
+{
+  (void)pElem; // Unused unless GSLC_FEATURE_TXT_SIZE_CACHE
+
+  // Fetch the size of the text to allow for justification
+  // NOTE: For multi-line text strings, the following call will
+  //       return the maximum dimensions of the entire block of
+  //       text, thus alignment will be based on the outer dimensions
+  //       not individual rows of text. As a result, the overall
+  //       text block will be rendered with the requested alignment
+  //       but individual rows will render like GSLC_ALIGNH_LEFT
+  //       within the aligned text block. Per-line justification
+  //       (with word wrap) is provided by GSLC_FEATURE_TXT_WRAP.
+  int16_t       nTxtOffsetX=0;
+  int16_t       nTxtOffsetY=0;
+  uint16_t      nTxtSzW=0;
+  uint16_t      nTxtSzH=0;
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  if (pElem != NULL) {
+    gslc_tsTxtSize* pTxtSize = &(pElem->sTxtSize);
+    if (!pTxtSize->bValid) {
+      gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+      pTxtSize->nOffsetX  = nTxtOffsetX;
+      pTxtSize->nOffsetY  = nTxtOffsetY;
+      pTxtSize->nSzW      = nTxtSzW;
+      pTxtSize->nSzH      = nTxtSzH;
+      pTxtSize->bValid    = true;
+    } else {
+      nTxtOffsetX = pTxtSize->nOffsetX;
+      nTxtOffsetY = pTxtSize->nOffsetY;
+      nTxtSzW     = pTxtSize->nSzW;
+      nTxtSzH     = pTxtSize->nSzH;
+    }
+  } else {
+    gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+  }
+#else
+  gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
+#endif // GSLC_FEATURE_TXT_SIZE_CACHE
+
+  // Calculate the text alignment
+  int16_t       nTxtX,nTxtY;
+  gslc_CalcTxtAlign(rTxt,eTxtAlign,nMarginW,nMarginH,nTxtSzW,nTxtSzH,&nTxtX,&nTxtY);
+
+  *prTxtBox     = (gslc_tsRect){nTxtX,nTxtY,nTxtSzW,nTxtSzH};
+  *pnTxtOffsetX = nTxtOffsetX;
+  *pnTxtOffsetY = nTxtOffsetY;
+}
+
+#if (GSLC_FEATURE_TXT_WRAP)
+// Copy a substring of a text string into a terminated line buffer
+// - The element's string is never modified, as it may be read-only
+//   (eg. a string literal)
+// - Returns false if the substring doesn't fit in the buffer
+static bool gslc_TxtLineCopy(char* acLine,const char* pStr,uint16_t nStart,uint16_t nEnd)
+{
+  if (nEnd - nStart >= GSLC_TXT_WRAP_LINE_LEN) {
+    return false;
+  }
+  memcpy(acLine,pStr+nStart,nEnd-nStart);
+  acLine[nEnd-nStart] = '\0';
+  return true;
+}
+
+// Measure a substring of a text string
+// - A substring longer than a line buffer is reported as
+//   too wide to fit on any line
+static void gslc_MeasureTxtSub(gslc_tsGui* pGui,gslc_tsFont* pTxtFont,const char* pStr,uint16_t nStart,uint16_t nEnd,
+  gslc_teTxtFlags eTxtFlags,int16_t* pnTxtOffsetX,int16_t* pnTxtOffsetY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  char acLine[GSLC_TXT_WRAP_LINE_LEN];
+  *pnTxtOffsetX = 0;
+  *pnTxtOffsetY = 0;
+  *pnTxtSzW     = 0;
+  *pnTxtSzH     = 0;
+  if (!gslc_TxtLineCopy(acLine,pStr,nStart,nEnd)) {
+    *pnTxtSzW   = 0xFFFF;
+    return;
+  }
+  gslc_DrvGetTxtSize(pGui,pTxtFont,acLine,eTxtFlags,pnTxtOffsetX,pnTxtOffsetY,pnTxtSzW,pnTxtSzH);
+}
+
+// Break an element's text string into lines that fit within nWrapW
+// - Lines are broken at spaces where possible, otherwise within
+//   a word. A newline always starts a new line.
+// - Text beyond the capacity of the line table is not laid out
+static void gslc_ElemCalcTxtLines(gslc_tsGui* pGui,gslc_tsElem* pElem,uint16_t nWrapW)
+{
+  char*           pStr      = pElem->pStrBuf;
+  gslc_teTxtFlags eTxtFlags = pElem->eTxtFlags;
+  bool            bUtf8     = ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  uint16_t        nPos      = 0;
+  uint16_t        nEnd,nScan,nNext;
+  int16_t         nOffsetX,nOffsetY;
+  uint16_t        nSzW,nSzH;
+  bool            bOverflow;
+  gslc_tsTxtLine* pLine;
+
+  pElem->nTxtLineCnt  = 0;
+  pElem->nTxtLineH    = 0;
+  while (pElem->nTxtLineCnt < pElem->nTxtLineMax) {
+    pLine = &(pElem->asTxtLine[pElem->nTxtLineCnt]);
+
+    // Start with an empty line
+    gslc_MeasureTxtSub(pGui,pElem->pTxtFont,pStr,nPos,nPos,eTxtFlags,&nOffsetX,&nOffsetY,&nSzW,&nSzH);
+    pLine->nStart   = nPos;
+    pLine->nW       = nSzW;
+    pLine->nOffsetX = nOffsetX;
+    pLine->nOffsetY = nOffsetY;
+    if (nSzH > pElem->nTxtLineH) { pElem->nTxtLineH = nSzH; }
+    nEnd = nPos;
+
+    // Extend the line a word at a time while it fits
+    bOverflow = false;
+    nScan = nPos;
+    while ((pStr[nScan] != '\0') && (pStr[nScan] != '\n')) {
+      nNext = nScan;
+      while (pStr[nNext] == ' ') { nNext++; }
+      if ((pStr[nNext] == '\0') || (pStr[nNext] == '\n')) {
+        // Ignore trailing spaces
+        break;
+      }
+      while ((pStr[nNext] != '\0') && (pStr[nNext] != ' ') && (pStr[nNext] != '\n')) { nNext++; }
+      gslc_MeasureTxtSub(pGui,pElem->pTxtFont,pStr,nPos,nNext,eTxtFlags,&nOffsetX,&nOffsetY,&nSzW,&nSzH);
+      if (nSzW > nWrapW) {
+        bOverflow = true;
+        break;
+      }
+      nEnd  = nNext;
+      nScan = nNext;
+      pLine->nW       = nSzW;
+      pLine->nOffsetX = nOffsetX;
+      pLine->nOffsetY = nOffsetY;
+      if (nSzH > pElem->nTxtLineH) { pElem->nTxtLineH = nSzH; }
+    }
+
+    // If the first word doesn't fit on its own, then break it
+    // after the last character that fits (but at least one)
+    if ((nEnd == nPos) && (bOverflow)) {
+      nScan = nPos;
+      do {
+        nNext = nScan + 1;
+        while ((bUtf8) && ((pStr[nNext] & 0xC0) == 0x80)) { nNext++; }
+        gslc_MeasureTxtSub(pGui,pElem->pTxtFont,pStr,nPos,nNext,eTxtFlags,&nOffsetX,&nOffsetY,&nSzW,&nSzH);
+        if ((nSzW > nWrapW) && (nEnd > nPos)) {
+          break;
+        }
+        nEnd  = nNext;
+        nScan = nNext;
+        pLine->nW       = nSzW;
+        pLine->nOffsetX = nOffsetX;
+        pLine->nOffsetY = nOffsetY;
+        if (nSzH > pElem->nTxtLineH) { pElem->nTxtLineH = nSzH; }
+      } while ((pStr[nScan] != '\0') && (pStr[nScan] != ' ') && (pStr[nScan] != '\n'));
+    }
+    pLine->nLen = nEnd - nPos;
+    pElem->nTxtLineCnt++;
+
+    // Advance to the start of the next line
+    // - Spaces at a wrapped line break are dropped
+    // - A newline that ends the string doesn't start another line
+    nPos = nEnd;
+    if (pStr[nPos] != '\n') {
+      while (pStr[nPos] == ' ') { nPos++; }
+    }
+    if (pStr[nPos] == '\n') {
+      nPos++;
+    }
+    if (pStr[nPos] == '\0') {
+      break;
+    }
+  }
+}
+
+// Render an element's text string as word-wrapped lines, each
+// aligned individually within the text region
+// - The line breaks and line widths are retained with the element
+//   and only recalculated when the text, font or region changes
+static void gslc_ElemDrawTxtLines(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsRect rTxt,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+{
+  char*     pStr      = pElem->pStrBuf;
+  int16_t   nWrapW    = (int16_t)rTxt.w - 2*nMarginW;
+  uint8_t   nLineInd;
+  char      acLine[GSLC_TXT_WRAP_LINE_LEN];
+
+  if (nWrapW < 1) { nWrapW = 1; }
+  if ((!pElem->bTxtLineValid) || (pElem->nTxtLineWrapW != (uint16_t)nWrapW)) {
+    gslc_ElemCalcTxtLines(pGui,pElem,(uint16_t)nWrapW);
+    pElem->nTxtLineWrapW  = (uint16_t)nWrapW;
+    pElem->bTxtLineValid  = true;
+  }
+
+  // Align the block of lines vertically and then each line horizontally
+  int16_t   nTxtX,nTxtY;
+  gslc_CalcTxtAlign(rTxt,eTxtAlign,nMarginW,nMarginH,0,pElem->nTxtLineCnt*pElem->nTxtLineH,&nTxtX,&nTxtY);
+  for (nLineInd=0;nLineInd<pElem->nTxtLineCnt;nLineInd++) {
+    gslc_tsTxtLine* pLine = &(pElem->asTxtLine[nLineInd]);
+    uint16_t        nEnd  = pLine->nStart + pLine->nLen;
+    int16_t         nLineY;
+    gslc_CalcTxtAlign(rTxt,eTxtAlign,nMarginW,nMarginH,pLine->nW,0,&nTxtX,&nLineY);
+    if (pLine->nLen == 0) {
+      nTxtY += pElem->nTxtLineH;
+      continue;
+    }
+    // Draw the line from a terminated copy
+    if (!gslc_TxtLineCopy(acLine,pStr,pLine->nStart,nEnd)) {
+      nTxtY += pElem->nTxtLineH;
+      continue;
+    }
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
+    gslc_DrvDrawTxt(pGui,nTxtX-pLine->nOffsetX,nTxtY-pLine->nOffsetY,pElem->pTxtFont,acLine,
+      pElem->eTxtFlags,colTxt,colBg);
+    nTxtY += pElem->nTxtLineH;
+  }
+}
+#endif // GSLC_FEATURE_TXT_WRAP
+#endif // DRV_HAS_DRAW_TEXT && !DRV_OVERRIDE_TXT_ALIGN
+
+// Internal text rendering routine
+// - If pElem is provided, the element's cached text dimensions
+//   may be used in place of a query to the driver
+static void gslc_DrawTxtElem(gslc_tsGui* pGui,gslc_tsElem* pElem,char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,
+  gslc_teTxtFlags eTxtFlags,int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+{
+  (void)pElem; // Unused unless GSLC_FEATURE_TXT_SIZE_CACHE
+
   // Overlay the text
   bool bRenderTxt = true;
   // Skip text render if buffer pointer not allocated
@@ -3021,56 +4342,43 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
     // calculations.
 
     // Provide bounding box and alignment flag to driver to calculate
-    int16_t nX0 = nElemX + nMarginW;
-    int16_t nY0 = nElemY + nMarginH;
-    int16_t nX1 = nX0 + nElemW - 2*nMarginW;
-    int16_t nY1 = nY0 + nElemH - 2*nMarginH;
+    int16_t nX0 = rTxt.x + nMarginW;
+    int16_t nY0 = rTxt.y + nMarginH;
+    int16_t nX1 = nX0 + rTxt.w - 2*nMarginW;
+    int16_t nY1 = nY0 + rTxt.h - 2*nMarginH;
 
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
     gslc_DrvDrawTxtAlign(pGui,nX0,nY0,nX1,nY1,eTxtAlign,pTxtFont,
             pStrBuf,eTxtFlags,colTxt,colBg);
 
 #else // DRV_OVERRIDE_TXT_ALIGN
 
+    #if (GSLC_FEATURE_TXT_WRAP)
+    // Word-wrap the text and align each line if enabled for the element
+    // - This requires the string to reside in RAM
+    if ((pElem != NULL) && (pElem->asTxtLine != NULL) &&
+        ((eTxtFlags & GSLC_TXT_MEM) != GSLC_TXT_MEM_PROG)) {
+      gslc_ElemDrawTxtLines(pGui,pElem,rTxt,eTxtAlign,colTxt,colBg,nMarginW,nMarginH);
+      return;
+    }
+    #endif
+
     // GUIslice will ask the driver for the text dimensions and calculate
     // the appropriate positioning to support the requested text
     // alignment mode.
-
-    // Fetch the size of the text to allow for justification
-    // NOTE: For multi-line text strings, the following call will
-    //       return the maximum dimensions of the entire block of
-    //       text, thus alignment will be based on the outer dimensions
-    //       not individual rows of text. As a result, the overall
-    //       text block will be rendered with the requested alignment
-    //       but individual rows will render like GSLC_ALIGNH_LEFT
-    //       within the aligned text block. In order to support per-line
-    //       horizontal justification, a pre-scan and alignment calculation
-    //       for each text row would need to be performed.
-    int16_t       nTxtOffsetX=0;
-    int16_t       nTxtOffsetY=0;
-    uint16_t      nTxtSzW=0;
-    uint16_t      nTxtSzH=0;
-    gslc_DrvGetTxtSize(pGui,pTxtFont,pStrBuf,eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
-
-    // Calculate the text alignment
-    int16_t       nTxtX,nTxtY;
-
-    // Check for ALIGNH_LEFT & ALIGNH_RIGHT. Default to ALIGNH_MID
-    if      (eTxtAlign & GSLC_ALIGNH_LEFT)     { nTxtX = nElemX+nMarginW; }
-    else if (eTxtAlign & GSLC_ALIGNH_RIGHT)    { nTxtX = nElemX+nElemW-nMarginW-nTxtSzW; }
-    else                                       { nTxtX = nElemX+(nElemW/2)-(nTxtSzW/2); }
-
-    // Check for ALIGNV_TOP & ALIGNV_BOT. Default to ALIGNV_MID
-    if      (eTxtAlign & GSLC_ALIGNV_TOP)      { nTxtY = nElemY+nMarginH; }
-    else if (eTxtAlign & GSLC_ALIGNV_BOT)      { nTxtY = nElemY+nElemH-nMarginH-nTxtSzH; }
-    else                                       { nTxtY = nElemY+(nElemH/2)-(nTxtSzH/2); }
+    gslc_tsRect   rTxtBox;
+    int16_t       nTxtOffsetX,nTxtOffsetY;
+    gslc_CalcTxtBox(pGui,pElem,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,nMarginW,nMarginH,
+      &rTxtBox,&nTxtOffsetX,&nTxtOffsetY);
 
     // Now correct for offset from text bounds
     // - This is used by the driver (such as Adafruit-GFX) to provide an
     //   adjustment for baseline height, etc.
-    nTxtX -= nTxtOffsetX;
-    nTxtY -= nTxtOffsetY;
+    int16_t       nTxtX = rTxtBox.x - nTxtOffsetX;
+    int16_t       nTxtY = rTxtBox.y - nTxtOffsetY;
 
     // Call the driver text rendering routine
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
     gslc_DrvDrawTxt(pGui,nTxtX,nTxtY,pTxtFont,pStrBuf,eTxtFlags,colTxt,colBg);
 
 #endif // DRV_OVERRIDE_TXT_ALIGN
@@ -3081,6 +4389,133 @@ void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFo
   }
 }
 
+void gslc_DrawTxtBase(gslc_tsGui* pGui, char* pStrBuf,gslc_tsRect rTxt,gslc_tsFont* pTxtFont,gslc_teTxtFlags eTxtFlags,
+  int8_t eTxtAlign,gslc_tsColor colTxt,gslc_tsColor colBg,int16_t nMarginW,int16_t nMarginH)
+{
+  gslc_DrawTxtElem(pGui,NULL,pStrBuf,rTxt,pTxtFont,eTxtFlags,eTxtAlign,colTxt,colBg,nMarginW,nMarginH);
+}
+
+#if (GSLC_FEATURE_TXT_DIFF)
+// Retain a copy of an element's text string after it has been drawn
+// - A string that doesn't fit in the buffer is recorded as empty,
+//   which prevents an incremental redraw from being attempted
+static void gslc_ElemTxtDiffSave(gslc_tsElem* pElem,gslc_tsRectState* pState)
+{
+  char* pStrBuf = pElem->pStrBuf;
+  if (pElem->pTxtDiffBuf == NULL) {
+    return;
+  }
+  pElem->bTxtDiffPend   = false;
+  pElem->pTxtDiffBuf[0] = '\0';
+  if ((pStrBuf == NULL) || ((pElem->eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG)) {
+    return;
+  }
+  if (strlen(pStrBuf) < pElem->nTxtDiffBufMax) {
+    strcpy(pElem->pTxtDiffBuf,pStrBuf);
+  }
+  pElem->colTxtDiffFore = pState->colTxtFore;
+  pElem->colTxtDiffBack = pState->colInner;
+  pElem->colTxtDiffFrame = pState->colFrm;
+}
+
+#if (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
+// Redraw only the character cells of an element's text string
+// that differ from the string that was last drawn
+// - The cell width is derived from the width of the entire string,
+//   so this assumes a fixed-width font
+// - Returns false if an incremental text redraw can't be performed,
+//   in which case the element should be redrawn in full
+static bool gslc_ElemDrawTxtDiff(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsRectState* pState)
+{
+  char*           pStrBuf   = pElem->pStrBuf;
+  char*           pStrPrev  = pElem->pTxtDiffBuf;
+  gslc_teTxtFlags eTxtFlags = pElem->eTxtFlags;
+  uint16_t        nLen,nInd;
+
+  if ((pStrPrev == NULL) || (pStrBuf == NULL)) { return false; }
+  // Only a redraw requested by a change in the text (rather than
+  // eg. a change in glow or edit state) is a candidate
+  if (!pElem->bTxtDiffPend) { return false; }
+  if ((eTxtFlags & GSLC_TXT_ALLOC) == GSLC_TXT_ALLOC_NONE) { return false; }
+  if ((eTxtFlags & GSLC_TXT_MEM) == GSLC_TXT_MEM_PROG) { return false; }
+  #if (GSLC_FEATURE_TXT_WRAP)
+  // Wrapped text can reflow when any character changes
+  if (pElem->asTxtLine != NULL) { return false; }
+  #endif
+
+  // Each changed cell is erased with the element fill, so the
+  // element must be opaque and have nothing else beneath the text
+  if (!(pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN)) { return false; }
+  if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) { return false; }
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,false);
+  if ((pImgRef != NULL) && (pImgRef->eImgFlags != GSLC_IMGREF_NONE)) { return false; }
+
+  // Anything drawn earlier in this redraw pass over the element
+  // (eg. a box beneath it) has painted over the unchanged cells
+  if (gslc_DrawPassOverlap(pGui,pElem->rElem)) { return false; }
+
+  // Any change in colors (eg. glowing) requires a full redraw
+  if (!gslc_ColorEqual(pElem->colTxtDiffFore,pState->colTxtFore)) { return false; }
+  if (!gslc_ColorEqual(pElem->colTxtDiffBack,pState->colInner)) { return false; }
+  if ((pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) &&
+      (!gslc_ColorEqual(pElem->colTxtDiffFrame,pState->colFrm))) { return false; }
+
+  // Only strings of the same length share character positions
+  nLen = (uint16_t)strlen(pStrBuf);
+  if ((nLen == 0) || (nLen != strlen(pStrPrev))) { return false; }
+  // Multi-line strings and multi-byte characters don't map to single cells
+  for (nInd=0;nInd<nLen;nInd++) {
+    uint8_t nChar = (uint8_t)(pStrBuf[nInd]);
+    if ((nChar < 0x20) || (nChar >= 0x80)) { return false; }
+  }
+
+  gslc_tsRect   rTxtBox;
+  int16_t       nTxtOffsetX,nTxtOffsetY;
+  gslc_CalcTxtBox(pGui,pElem,pStrBuf,pState->rInner,pElem->pTxtFont,eTxtFlags,pElem->eTxtAlign,
+    pElem->nTxtMarginX,pElem->nTxtMarginY,&rTxtBox,&nTxtOffsetX,&nTxtOffsetY);
+
+  // A string that doesn't divide evenly into cells isn't from
+  // a fixed-width font
+  if ((rTxtBox.w % nLen) != 0) { return false; }
+  // Text that extends outside of the element can't be erased by
+  // filling its cells
+  gslc_tsRect rInner = pState->rInner;
+  if ((rTxtBox.x < rInner.x) || (rTxtBox.y < rInner.y) ||
+      (rTxtBox.x + rTxtBox.w > rInner.x + rInner.w) || (rTxtBox.y + rTxtBox.h > rInner.y + rInner.h)) {
+    return false;
+  }
+
+  // Redraw each run of adjacent changed characters
+  uint16_t      nCellW = rTxtBox.w / nLen;
+  gslc_tsRect   rRun = rTxtBox;
+  char          acRun[16];
+  uint16_t      nRunLen;
+  nInd = 0;
+  while (nInd < nLen) {
+    if (pStrBuf[nInd] == pStrPrev[nInd]) {
+      nInd++;
+      continue;
+    }
+    nRunLen = 0;
+    while ((nInd+nRunLen < nLen) && (nRunLen < sizeof(acRun)-1) && (pStrBuf[nInd+nRunLen] != pStrPrev[nInd+nRunLen])) {
+      acRun[nRunLen] = pStrBuf[nInd+nRunLen];
+      nRunLen++;
+    }
+    acRun[nRunLen] = '\0';
+    rRun.x = rTxtBox.x + nInd*nCellW;
+    rRun.w = nRunLen*nCellW;
+    gslc_DrawFillRect(pGui,rRun,pState->colInner);
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
+    gslc_DrvDrawTxt(pGui,rRun.x-nTxtOffsetX,rRun.y-nTxtOffsetY,pElem->pTxtFont,acRun,eTxtFlags,
+      pState->colTxtFore,pState->colTxtBack);
+    GSLC_STATS_ADD(pGui,nTxtDiffCell,nRunLen);
+    nInd += nRunLen;
+  }
+  return true;
+}
+#endif // DRV_HAS_DRAW_TEXT && !DRV_OVERRIDE_TXT_ALIGN
+#endif // GSLC_FEATURE_TXT_DIFF
+
 // Draw an element to the active display
 // - Element is referenced by an element pointer
 // - TODO: Handle GSLC_TYPE_BKGND
@@ -3107,6 +4542,16 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  #if (GSLC_FEATURE_STATS)
+  if (eRedraw == GSLC_REDRAW_FULL) {
+    pGui->sStats.nElemDrawFull++;
+  } else if (eRedraw == GSLC_REDRAW_INC) {
+    pGui->sStats.nElemDrawInc++;
+  } else if (eRedraw == GSLC_REDRAW_FOCUS) {
+    pGui->sStats.nElemDrawFocus++;
+  }
+  #endif
+
   // --------------------------------------------------------------------------
   // Init for default drawing
   // --------------------------------------------------------------------------
@@ -3169,6 +4614,16 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     return true;
   }
 
+  #if (GSLC_FEATURE_TXT_DIFF) && (DRV_HAS_DRAW_TEXT) && !(DRV_OVERRIDE_TXT_ALIGN)
+  // If only the text has changed, then attempt to redraw just
+  // the characters that differ
+  if ((eRedraw == GSLC_REDRAW_INC) && (gslc_ElemDrawTxtDiff(pGui,pElem,&sState))) {
+    gslc_ElemTxtDiffSave(pElem,&sState);
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
+    return true;
+  }
+  #endif
+
 
   // --------------------------------------------------------------------------
   // Background
@@ -3198,13 +4653,17 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
   // --------------------------------------------------------------------------
 
   // Draw any images associated with element
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    if ((bGlowing) && (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE)) {
-      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefGlow);
+  gslc_tsImgRef* pImgRefNorm = gslc_ElemGetImgRef(pGui,pElem,false,false);
+  gslc_tsImgRef* pImgRefGlow = gslc_ElemGetImgRef(pGui,pElem,true,false);
+  if ((pImgRefNorm != NULL) && (pImgRefNorm->eImgFlags != GSLC_IMGREF_NONE)) {
+    if ((bGlowing) && (pImgRefGlow->eImgFlags != GSLC_IMGREF_NONE)) {
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_IMAGE);
+      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,*pImgRefGlow);
     } else {
       // Note that when we are focused we are highlighting the frame
       // so we just draw the normal image.
-      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,pElem->sImgRefNorm);
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_IMAGE);
+      bOk = gslc_DrvDrawImage(pGui,nElemX,nElemY,*pImgRefNorm);
     }
     if (!bOk) {
       GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage failed\n","");
@@ -3239,12 +4698,23 @@ bool gslc_ElemDrawByRef(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     int8_t        nMarginX  = pElem->nTxtMarginX;
     int8_t        nMarginY  = pElem->nTxtMarginY;
 
+    // Text caches are only retained by elements in RAM. For read-only
+    // elements, pElem is a temporary copy or resides in FLASH.
+    gslc_tsElem*  pElemCache = pElem;
+    if ((pElemRef->eElemFlags & GSLC_ELEMREF_SRC) != GSLC_ELEMREF_SRC_RAM) {
+      pElemCache = NULL;
+    }
+
     // Note that we use the "inner" region for text placement to
     // avoid overlapping any frame
-    gslc_DrawTxtBase(pGui, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
+    gslc_DrawTxtElem(pGui, pElemCache, pElem->pStrBuf, sState.rInner, pElem->pTxtFont, pElem->eTxtFlags,
       pElem->eTxtAlign, sState.colTxtFore, sState.colTxtBack, nMarginX, nMarginY);
   }
 
+  #if (GSLC_FEATURE_TXT_DIFF)
+  gslc_ElemTxtDiffSave(pElem,&sState);
+  #endif
+
   // --------------------------------------------------------------------------
 
   // Mark the element as no longer requiring redraw
@@ -3268,6 +4738,10 @@ void gslc_ElemSetFillEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bFillEn)
   } else {
     pElem->nFeatures &= ~GSLC_ELEM_FEA_FILL_EN;
   }
+  #if (GSLC_FEATURE_OCCLUDE)
+  // The opaque rects used for occlusion need to be recalculated
+  pGui->bOccludeValid = false;
+  #endif
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3306,15 +4780,52 @@ void gslc_ElemSetRoundEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bRoundEn
   } else {
     pElem->nFeatures &= ~GSLC_ELEM_FEA_ROUND_EN;
   }
+  #if (GSLC_FEATURE_OCCLUDE)
+  // The opaque rects used for occlusion need to be recalculated
+  pGui->bOccludeValid = false;
+  #endif
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
 
+#if (GSLC_FEATURE_STYLE)
+// Fetch the shared style assigned to an element (or NULL if none)
+static const gslc_tsStyle* gslc_ElemGetStyle(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  uint8_t nStyle = pElem->nStyle;
+  if ((nStyle == GSLC_STYLE_NONE) || (nStyle > pGui->nStyleCnt)) {
+    return NULL;
+  }
+  return &(pGui->asStyle[nStyle-1]);
+}
+
+// Detach an element from its shared style so that its own colors
+// can be changed. The element's colors are first loaded from the
+// style so that its appearance is retained.
+static void gslc_ElemStyleDetach(gslc_tsGui* pGui,gslc_tsElem* pElem)
+{
+  const gslc_tsStyle* pStyle = gslc_ElemGetStyle(pGui,pElem);
+  if (pStyle != NULL) {
+    pElem->colElemFrame     = pStyle->colFrame;
+    pElem->colElemFill      = pStyle->colFill;
+    pElem->colElemFrameGlow = pStyle->colFrameGlow;
+    pElem->colElemFillGlow  = pStyle->colFillGlow;
+    pElem->colElemText      = pStyle->colText;
+    pElem->colElemTextGlow  = pStyle->colTextGlow;
+  }
+  pElem->nStyle = GSLC_STYLE_NONE;
+}
+#endif // GSLC_FEATURE_STYLE
+
 void gslc_ElemSetCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor colFrame,gslc_tsColor colFill,gslc_tsColor colFillGlow)
 {
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
+#if (GSLC_FEATURE_STYLE)
+  gslc_ElemStyleDetach(pGui,pElem);
+#endif
+
   if (!gslc_ColorEqual(pElem->colElemFrame, colFrame) ||
       !gslc_ColorEqual(pElem->colElemFill, colFill) ||
       !gslc_ColorEqual(pElem->colElemFillGlow, colFillGlow)) {
@@ -3330,6 +4841,10 @@ void gslc_ElemSetGlowCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
+#if (GSLC_FEATURE_STYLE)
+  gslc_ElemStyleDetach(pGui,pElem);
+#endif
+
   if (!gslc_ColorEqual(pElem->colElemFrameGlow, colFrameGlow) ||
       !gslc_ColorEqual(pElem->colElemFillGlow, colFillGlow) ||
       !gslc_ColorEqual(pElem->colElemTextGlow, colTxtGlow)) {
@@ -3371,6 +4886,16 @@ void gslc_ElemSetRect(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsRect rEle
   // Update element
   pElem->rElem           = rElem;
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Hit-test indices need to be rebuilt
+  pGui->nHitGridGen++;
+  #endif
+
+  #if (GSLC_FEATURE_OCCLUDE)
+  // The opaque rects used for occlusion need to be recalculated
+  pGui->bOccludeValid = false;
+  #endif
+
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3389,6 +4914,9 @@ void gslc_ElemSetTxtAlign(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned nAl
   if (!pElem) return;
 
   pElem->eTxtAlign        = nAlign;
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  pElem->sTxtSize.bValid  = false;
+#endif
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3446,6 +4974,14 @@ void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pS
 
   if (strncmp(pElem->pStrBuf,pStr,pElem->nStrBufMax)) {
     gslc_StrCopy(pElem->pStrBuf,pStr,pElem->nStrBufMax);
+    gslc_ElemTxtCacheReset(pGui,pElemRef);
+    #if (GSLC_FEATURE_TXT_DIFF)
+    // Allow an incremental redraw of the changed characters
+    // - Read-only elements can't have a diff buffer
+    if (pElem->pTxtDiffBuf != NULL) {
+      pElem->bTxtDiffPend = true;
+    }
+    #endif
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -3462,6 +4998,10 @@ void gslc_ElemSetTxtCol(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsColor c
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
+#if (GSLC_FEATURE_STYLE)
+  gslc_ElemStyleDetach(pGui,pElem);
+#endif
+
   if (!gslc_ColorEqual(pElem->colElemText, colVal) ||
       !gslc_ColorEqual(pElem->colElemTextGlow, colVal)) {
     pElem->colElemText      = colVal;
@@ -3487,6 +5027,7 @@ void gslc_ElemSetTxtMem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
   }
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_MEM) | (eFlags & GSLC_TXT_MEM);
+  gslc_ElemTxtCacheReset(pGui,pElemRef);
 }
 
 void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlags eFlags)
@@ -3496,7 +5037,45 @@ void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
 
   gslc_teTxtFlags eFlagsCur = pElem->eTxtFlags;
   pElem->eTxtFlags = (eFlagsCur & ~GSLC_TXT_ENC) | (eFlags & GSLC_TXT_ENC);
+  gslc_ElemTxtCacheReset(pGui,pElemRef);
+}
+
+#if (GSLC_FEATURE_TXT_DIFF)
+void gslc_ElemSetTxtDiffBuf(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pBuf,uint8_t nBufMax)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+
+  if ((pBuf != NULL) && (nBufMax == 0)) {
+    pBuf = NULL;
+  }
+  pElem->pTxtDiffBuf      = pBuf;
+  pElem->nTxtDiffBufMax   = nBufMax;
+  // The buffer contents aren't known to match the display
+  // until the element has been drawn in full
+  if (pBuf != NULL) {
+    pBuf[0] = '\0';
+  }
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+}
+#endif // GSLC_FEATURE_TXT_DIFF
+
+#if (GSLC_FEATURE_TXT_WRAP)
+void gslc_ElemSetTxtWrap(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsTxtLine* asLine,uint8_t nLineMax)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+
+  if ((asLine != NULL) && (nLineMax == 0)) {
+    asLine = NULL;
+  }
+  pElem->asTxtLine        = asLine;
+  pElem->nTxtLineMax      = nLineMax;
+  pElem->nTxtLineCnt      = 0;
+  pElem->bTxtLineValid    = false;
+  gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
+#endif // GSLC_FEATURE_TXT_WRAP
 
 void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
 {
@@ -3504,6 +5083,7 @@ void gslc_ElemUpdateFont(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int nFontId)
   if (!pElem) return;
 
   pElem->pTxtFont = gslc_FontGet(pGui,nFontId);
+  gslc_ElemTxtCacheReset(pGui,pElemRef);
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 }
 
@@ -3536,6 +5116,11 @@ void gslc_ElemSetRedraw(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRedrawT
     // Indicate that at least one element requires redraw
     pGui->bRedrawNeeded = true;
 
+    // Track the element so that the redraw can visit it directly
+    if (eFlagsRedrawOld == GSLC_ELEMREF_REDRAW_NONE) {
+      gslc_DirtyElemAdd(pGui,pElemRef);
+    }
+
     // For all cases where a new redraw has been requested,
     // only update the redraw state if we are increasing
     // the level of redraw.
@@ -3755,6 +5340,9 @@ void gslc_ElemSetVisible(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bVisible
 
   // Mark the element as needing redraw if its visibility status changed
   if (bVisible != bVisibleOld) {
+    #if (GSLC_FEATURE_OCCLUDE)
+    pGui->bOccludeValid = false;
+    #endif
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
     if (bVisible == false) {
       // Since we are hiding an element, we need to invalidate
@@ -3876,6 +5464,11 @@ void gslc_ElemSetClickEn(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bClickEn
     pElem->nFeatures &= ~GSLC_ELEM_FEA_CLICK_EN;
   }
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Hit-test indices only include clickable elements, so they need to be rebuilt
+  pGui->nHitGridGen++;
+  #endif
+
   #if (GSLC_FEATURE_INPUT)
   // For now, associate accepting click events as also accepting focus
   // We call this API since it also takes care of resizing 
@@ -3908,13 +5501,31 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   // rElem
   pElemDest->nGroup           = pElemSrc->nGroup;
   pElemDest->nFeatures        = pElemSrc->nFeatures;
+#if (GSLC_FEATURE_ELEM_COLD)
+  // Give the destination its own side record so that
+  // later changes don't affect the source element
+  if (pElemSrc->pElemCold != NULL) {
+    if (gslc_ElemColdAlloc(pGui,pElemDest) != NULL) {
+      *(pElemDest->pElemCold) = *(pElemSrc->pElemCold);
+    }
+  } else if (pElemDest->pElemCold != NULL) {
+    pElemDest->pElemCold->sImgRefNorm = gslc_ResetImage();
+    pElemDest->pElemCold->sImgRefGlow = gslc_ResetImage();
+    pElemDest->pElemCold->pfuncXTick  = NULL;
+    gslc_ElemColdRelease(pGui,pElemDest);
+  }
+#else
   pElemDest->sImgRefNorm      = pElemSrc->sImgRefNorm;
   pElemDest->sImgRefGlow      = pElemSrc->sImgRefGlow;
+#endif
 
   pElemDest->colElemFill      = pElemSrc->colElemFill;
   pElemDest->colElemFillGlow  = pElemSrc->colElemFillGlow;
   pElemDest->colElemFrame     = pElemSrc->colElemFrame;
   pElemDest->colElemFrameGlow = pElemSrc->colElemFrameGlow;
+#if (GSLC_FEATURE_STYLE)
+  pElemDest->nStyle           = pElemSrc->nStyle;
+#endif
 
   // eRedraw
 #if (GSLC_FEATURE_COMPOUND)
@@ -3933,13 +5544,18 @@ void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsE
   pElemDest->nTxtMarginX      = pElemSrc->nTxtMarginX;
   pElemDest->nTxtMarginY      = pElemSrc->nTxtMarginY;
   pElemDest->pTxtFont         = pElemSrc->pTxtFont;
+  gslc_ElemTxtCacheReset(pGui,pElemRefDest);
 
   // pXData
 
   //pElemDest->pfuncXEvent      = pElemSrc->pfuncXEvent; // UNUSED
   pElemDest->pfuncXDraw       = pElemSrc->pfuncXDraw;
   pElemDest->pfuncXTouch      = pElemSrc->pfuncXTouch;
+#if !(GSLC_FEATURE_ELEM_COLD)
   pElemDest->pfuncXTick       = pElemSrc->pfuncXTick;
+#endif
+  // Keep the tick schedule in step with the copied tick callback
+  gslc_ElemTickSync(pGui,pElemRefDest,(gslc_ElemGetTickFuncPtr(pElemDest) != NULL));
 
   gslc_ElemSetRedraw(pGui,pElemRefDest,GSLC_REDRAW_FULL);
 }
@@ -4002,6 +5618,62 @@ void gslc_ElemGrowRect(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, int8_t nDelta
   }
 }
 
+#if (GSLC_FEATURE_STYLE)
+void gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nStyleId)
+{
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+
+  if (nStyleId > pGui->nStyleCnt) {
+    GSLC_DEBUG2_PRINT("ERROR: ElemSetStyle() invalid style ID (%u)\n",nStyleId);
+    return;
+  }
+  if (pElem->nStyle != nStyleId) {
+    pElem->nStyle = nStyleId;
+    gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
+  }
+}
+#endif // GSLC_FEATURE_STYLE
+
+gslc_tsColor gslc_ElemGetColFrame(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow)
+{
+#if (GSLC_FEATURE_STYLE)
+  const gslc_tsStyle* pStyle = gslc_ElemGetStyle(pGui,pElem);
+  if (pStyle != NULL) {
+    return (bGlow)? pStyle->colFrameGlow : pStyle->colFrame;
+  }
+#else
+  (void)pGui; // Unused
+#endif
+  return (bGlow)? pElem->colElemFrameGlow : pElem->colElemFrame;
+}
+
+gslc_tsColor gslc_ElemGetColFill(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow)
+{
+#if (GSLC_FEATURE_STYLE)
+  const gslc_tsStyle* pStyle = gslc_ElemGetStyle(pGui,pElem);
+  if (pStyle != NULL) {
+    return (bGlow)? pStyle->colFillGlow : pStyle->colFill;
+  }
+#else
+  (void)pGui; // Unused
+#endif
+  return (bGlow)? pElem->colElemFillGlow : pElem->colElemFill;
+}
+
+gslc_tsColor gslc_ElemGetColTxt(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow)
+{
+#if (GSLC_FEATURE_STYLE)
+  const gslc_tsStyle* pStyle = gslc_ElemGetStyle(pGui,pElem);
+  if (pStyle != NULL) {
+    return (bGlow)? pStyle->colTextGlow : pStyle->colText;
+  }
+#else
+  (void)pGui; // Unused
+#endif
+  return (bGlow)? pElem->colElemTextGlow : pElem->colElemText;
+}
+
 void gslc_ResetRectState(gslc_tsRectState *pState)
 {
   if (!pState) {
@@ -4069,16 +5741,10 @@ void gslc_ElemCalcRectState(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, gslc_tsR
   #endif // GSLC_FEATURE_INPUT
 
   // Calculate the element colors
-  pState->colBack = pElem->colElemFill;
-  if (bGlowing) {
-    pState->colFrm = pElem->colElemFrameGlow;
-    pState->colInner = pElem->colElemFillGlow;
-    pState->colTxtFore = pElem->colElemTextGlow;
-  } else {
-    pState->colFrm = pElem->colElemFrame;
-    pState->colInner = pElem->colElemFill;
-    pState->colTxtFore = pElem->colElemText;
-  }
+  pState->colBack = gslc_ElemGetColFill(pGui,pElem,false);
+  pState->colFrm = gslc_ElemGetColFrame(pGui,pElem,bGlowing);
+  pState->colInner = gslc_ElemGetColFill(pGui,pElem,bGlowing);
+  pState->colTxtFore = gslc_ElemGetColTxt(pGui,pElem,bGlowing);
 
   // Calculate text background color
   if (bFillEn) {
@@ -4117,7 +5783,37 @@ void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK
   gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
   if (!pElem) return;
 
+#if (GSLC_FEATURE_ELEM_COLD)
+  if (funcCb != NULL) {
+    if (gslc_ElemColdAlloc(pGui,pElem) == NULL) {
+      return;
+    }
+  }
+  if (pElem->pElemCold != NULL) {
+    pElem->pElemCold->pfuncXTick = funcCb;
+    gslc_ElemColdRelease(pGui,pElem);
+  }
+#else
   pElem->pfuncXTick       = funcCb;
+#endif
+
+  gslc_ElemTickSync(pGui,pElemRef,(funcCb != NULL));
+}
+
+void gslc_ElemSetTickPeriod(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriod)
+{
+  if ((pGui == NULL) || (pElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "ElemSetTickPeriod";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  gslc_tsElem* pElem = gslc_GetElemFromRefD(pGui, pElemRef, __LINE__);
+  if (!pElem) return;
+  // Only elements with a tick callback occupy a schedule entry
+  if (gslc_ElemGetTickFuncPtr(pElem) == NULL) {
+    return;
+  }
+  gslc_TickAdd(pGui,pElemRef,nPeriod);
 }
 
 bool gslc_ElemOwnsCoord(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,int16_t nX,int16_t nY,bool bOnlyClickEn)
@@ -5363,6 +7059,67 @@ bool gslc_CollectEvent(void* pvGui,gslc_tsEvent sEvent)
 }
 
 
+#if (GSLC_ID_INDEX == GSLC_ID_INDEX_HASH)
+// Determine the home slot for an element ID in a hashed ID index
+// - Element IDs are commonly assigned sequentially, so folding
+//   the upper byte into the lower bits is sufficient
+static uint16_t gslc_CollectIdHash(int16_t nId)
+{
+  uint16_t nHash = (uint16_t)nId;
+  nHash ^= (nHash >> 8);
+  return nHash & (GSLC_ID_INDEX_MAX-1);
+}
+#endif // GSLC_ID_INDEX_HASH
+
+#if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+// Record a newly added element reference in the collection's ID index
+// - The index only covers a contiguous run of leading element
+//   references, so once an element can't be recorded, all later
+//   elements are left for the linear search
+static void gslc_CollectIdIndexAdd(gslc_tsCollect* pCollect,int16_t nId,uint16_t nInd)
+{
+  if (pCollect->nIdIndexCnt != nInd) {
+    return;
+  }
+
+  #if (GSLC_ID_INDEX == GSLC_ID_INDEX_SORTED)
+  if (pCollect->nIdIndexUsed >= GSLC_ID_INDEX_MAX) {
+    return;
+  }
+  // Insert after any entries with the same ID so that the
+  // earliest element with a given ID is found first
+  uint16_t nPos = pCollect->nIdIndexUsed;
+  while ((nPos > 0) && (pCollect->asIdIndex[nPos-1].nId > nId)) {
+    pCollect->asIdIndex[nPos] = pCollect->asIdIndex[nPos-1];
+    nPos--;
+  }
+  pCollect->asIdIndex[nPos].nId  = nId;
+  pCollect->asIdIndex[nPos].nInd = nInd;
+  pCollect->nIdIndexUsed++;
+
+  #else // GSLC_ID_INDEX_HASH
+  // Keep the table at most 3/4 full so that probe sequences stay short
+  if ((pCollect->nIdIndexUsed+1)*4 > GSLC_ID_INDEX_MAX*3) {
+    return;
+  }
+  uint16_t nSlot = gslc_CollectIdHash(nId);
+  while (pCollect->asIdIndex[nSlot].nInd != GSLC_ID_INDEX_EMPTY) {
+    if (pCollect->asIdIndex[nSlot].nId == nId) {
+      // Keep the earliest element with this ID
+      pCollect->nIdIndexCnt++;
+      return;
+    }
+    nSlot = (nSlot+1) & (GSLC_ID_INDEX_MAX-1);
+  }
+  pCollect->asIdIndex[nSlot].nId  = nId;
+  pCollect->asIdIndex[nSlot].nInd = nInd;
+  pCollect->nIdIndexUsed++;
+  #endif // GSLC_ID_INDEX
+
+  pCollect->nIdIndexCnt++;
+}
+#endif // GSLC_ID_INDEX
+
 // NOTE:
 // - When eFlags=GSLC_ELEMREF_SRC_RAM, the contents of pElem are copied into
 //   the internal element array so that the pointer (pElem) can be released
@@ -5440,15 +7197,11 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
     // External reference
     // - Pointer (pElem) links to an element stored in FLASH (must be declared statically)
 
-    // Fetch a RAM copy of the FLASH element
-    #if (GSLC_USE_PROGMEM)
-    memcpy_P(&pGui->sElemTmpProg,pElem,sizeof(gslc_tsElem));
-    #endif
-
     #if defined(DBG_LOG)
+      // Fetch a RAM copy of the FLASH element
       const gslc_tsElem* pElemRam = pElem; // Local element in RAM
       #if (GSLC_USE_PROGMEM)
-        pElemRam = &pGui->sElemTmpProg;
+        pElemRam = gslc_ElemProgCacheGet(pGui,pElem);
       #endif
     GSLC_DEBUG_PRINT("INFO:   Add elem to collection: ElemRef=%d/%d, ElemId=%u (FLASH)\n",
             pCollect->nElemRefCnt+1,pCollect->nElemRefMax,pElemRam->nId);
@@ -5464,7 +7217,17 @@ gslc_tsElemRef* gslc_CollectElemAdd(gslc_tsGui* pGui,gslc_tsCollect* pCollect,co
   // Fetch a pointer to the element reference array entry
   gslc_tsElemRef* pElemRef = &(pCollect->asElemRef[nElemRefInd]);
 
+  #if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+  // Record the element in the ID index
+  gslc_CollectIdIndexAdd(pCollect,gslc_GetElemFromRef(pGui,pElemRef)->nId,nElemRefInd);
+  #endif
+
   // Mark any newly added element as requiring redraw
+  // - If the redraw state was already provided in eFlags then
+  //   ElemSetRedraw() won't see a change, so track it here
+  if ((eFlags & GSLC_ELEMREF_REDRAW_MASK) != GSLC_ELEMREF_REDRAW_NONE) {
+    gslc_DirtyElemAdd(pGui,pElemRef);
+  }
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_FULL);
 
   // Return the new element reference
@@ -5531,6 +7294,10 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
 
   gslc_tsCollect* pCollect = &pPage->sCollect;
   gslc_tsElemRef* pElemRefAdd = gslc_CollectElemAdd(pGui,pCollect,pElem,eFlags);
+  if (pElemRefAdd == NULL) {
+    // Error already reported (eg. page is full)
+    return NULL;
+  }
 
   // Determine any change in sizing and update the element
   int8_t nResizeNew = gslc_ElemCalcResizeForFocus(pGui,pElemRefAdd);
@@ -5544,9 +7311,76 @@ gslc_tsElemRef* gslc_ElemAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* pElem
   // Update the page's bounding rect
   gslc_UnionRect(&(pPage->rBounds), pElemLocal->rElem);
 
+  #if (GSLC_FEATURE_OCCLUDE)
+  pGui->bOccludeValid = false;
+  #endif
+
+  // Schedule any tick callback that was provided with the element
+  // (eg. when the element was defined in FLASH)
+  if (gslc_ElemGetTickFuncPtr(pElemLocal) != NULL) {
+    gslc_TickAdd(pGui,pElemRefAdd,0);
+  }
+
   return pElemRefAdd;
 }
 
+// Add a page with a compile-time element reference table
+// - Loads the read-only table into the RAM reference array and
+//   performs the per-element bookkeeping of gslc_ElemAdd()
+//   without copying any elements
+bool gslc_PageAddStatic(gslc_tsGui* pGui,int16_t nPageId,const gslc_tsElemRef* psElemRefDef,
+  gslc_tsElemRef* psElemRef,uint16_t nElemRefCnt)
+{
+  if ((pGui == NULL) || (psElemRefDef == NULL) || (psElemRef == NULL)) {
+    static const char GSLC_PMEM FUNCSTR[] = "PageAddStatic";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  uint8_t nPageCnt = pGui->nPageCnt;
+  gslc_PageAdd(pGui,nPageId,NULL,0,psElemRef,nElemRefCnt);
+  if (pGui->nPageCnt == nPageCnt) {
+    return false;
+  }
+
+  gslc_tsPage*    pPage     = &pGui->asPage[nPageCnt];
+  gslc_tsCollect* pCollect  = &pPage->sCollect;
+  gslc_tsElemRef* pElemRef;
+  gslc_tsElem*    pElem;
+  uint16_t        nInd;
+
+  pCollect->nElemRefCnt = nElemRefCnt;
+
+  for (nInd=0;nInd<nElemRefCnt;nInd++) {
+    pElemRef = &(psElemRef[nInd]);
+
+    // Load the reference (element pointer and initial state flags)
+    #if (GSLC_USE_PROGMEM)
+    memcpy_P(pElemRef,&psElemRefDef[nInd],sizeof(gslc_tsElemRef));
+    #else
+    *pElemRef = psElemRefDef[nInd];
+    #endif
+
+    // Determine any change in sizing and update the element
+    int8_t nResizeNew = gslc_ElemCalcResizeForFocus(pGui,pElemRef);
+    gslc_ElemGrowRect(pGui,pElemRef,(nResizeNew-0));
+
+    pElem = gslc_GetElemFromRef(pGui,pElemRef);
+
+    #if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+    gslc_CollectIdIndexAdd(pCollect,pElem->nId,nInd);
+    #endif
+
+    gslc_UnionRect(&(pPage->rBounds), pElem->rElem);
+
+    if (gslc_ElemGetTickFuncPtr(pElem) != NULL) {
+      gslc_TickAdd(pGui,pElemRef,0);
+    }
+  }
+
+  // The page as a whole was already marked for redraw by PageAdd()
+  return true;
+}
+
 gslc_tsRect gslc_GetClipRect(gslc_tsGui* pGui)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -5598,6 +7432,10 @@ void gslc_ElemSetImage(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsImgRef s
   // Update the normal and glowing images
   gslc_DrvSetElemImageNorm(pGui,pElem,sImgRef);
   gslc_DrvSetElemImageGlow(pGui,pElem,sImgRefSel);
+#if (GSLC_FEATURE_ELEM_COLD)
+  // Clearing both images may leave the side record unused
+  gslc_ElemColdRelease(pGui,pElem);
+#endif
 
   // Mark as needing redraw only if the image has changed
   if (!bImagesEqual) {
@@ -5631,6 +7469,38 @@ bool gslc_SetTransparentColor(gslc_tsGui* pGui, gslc_tsColor nCol)
   return true;
 }
 
+#if (GSLC_FEATURE_STYLE)
+void gslc_SetStyleTable(gslc_tsGui* pGui,gslc_tsStyle* asStyle,uint8_t nStyleCnt)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetStyleTable";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return;
+  }
+  pGui->asStyle   = asStyle;
+  pGui->nStyleCnt = (asStyle != NULL)? nStyleCnt : 0;
+  gslc_PageRedrawSet(pGui,true);
+}
+
+bool gslc_SetStyle(gslc_tsGui* pGui,uint8_t nStyleId,gslc_tsStyle sStyle)
+{
+  if (pGui == NULL) {
+    static const char GSLC_PMEM FUNCSTR[] = "SetStyle";
+    GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
+    return false;
+  }
+  if ((nStyleId == GSLC_STYLE_NONE) || (nStyleId > pGui->nStyleCnt)) {
+    GSLC_DEBUG2_PRINT("ERROR: SetStyle() invalid style ID (%u)\n",nStyleId);
+    return false;
+  }
+  pGui->asStyle[nStyleId-1] = sStyle;
+  // Elements sharing the style aren't tracked individually,
+  // so redraw the whole page
+  gslc_PageRedrawSet(pGui,true);
+  return true;
+}
+#endif // GSLC_FEATURE_STYLE
+
 bool gslc_GuiRotate(gslc_tsGui* pGui, uint8_t nRotation)
 {
   // Simple wrapper for driver-specific rotation
@@ -5692,8 +7562,12 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   pElem->nType            = GSLC_TYPE_BOX;
   pElem->nGroup           = GSLC_GROUP_ID_NONE;
   pElem->rElem            = (gslc_tsRect){0,0,0,0};
+#if (GSLC_FEATURE_ELEM_COLD)
+  pElem->pElemCold        = NULL;
+#else
   pElem->sImgRefNorm      = gslc_ResetImage();
   pElem->sImgRefGlow      = gslc_ResetImage();
+#endif
   pElem->colElemFrame     = GSLC_COL_WHITE;
   pElem->colElemFill      = GSLC_COL_WHITE;
   pElem->colElemFrameGlow = GSLC_COL_WHITE;
@@ -5708,16 +7582,37 @@ void gslc_ResetElem(gslc_tsElem* pElem)
   #endif
   pElem->colElemText      = GSLC_COL_WHITE;
   pElem->colElemTextGlow  = GSLC_COL_WHITE;
+#if (GSLC_FEATURE_STYLE)
+  pElem->nStyle           = GSLC_STYLE_NONE;
+#endif
   pElem->eTxtAlign        = GSLC_ALIGN_MID_MID;
   pElem->nTxtMarginX      = 0;
   pElem->nTxtMarginY      = 0;
   pElem->pTxtFont         = NULL;
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  pElem->sTxtSize.bValid  = false;
+#endif
+#if (GSLC_FEATURE_TXT_WRAP)
+  pElem->asTxtLine        = NULL;
+  pElem->nTxtLineMax      = 0;
+  pElem->nTxtLineCnt      = 0;
+  pElem->bTxtLineValid    = false;
+#endif
+#if (GSLC_FEATURE_TXT_DIFF)
+  pElem->pTxtDiffBuf      = NULL;
+  pElem->nTxtDiffBufMax   = 0;
+  pElem->bTxtDiffPend     = false;
+#endif
 
   pElem->pXData           = NULL;
+#if !(GSLC_FEATURE_ELEM_COLD)
   pElem->pfuncXEvent      = NULL; // UNUSED
+#endif
   pElem->pfuncXDraw       = NULL;
   pElem->pfuncXTouch      = NULL;
+#if !(GSLC_FEATURE_ELEM_COLD)
   pElem->pfuncXTick       = NULL;
+#endif
 #if (GSLC_FEATURE_COMPOUND)
   pElem->pElemRefParent   = NULL;
 #endif
@@ -5748,13 +7643,15 @@ void gslc_ElemDestruct(gslc_tsElem* pElem)
     GSLC_DEBUG2_PRINT_CONST(ERRSTR_NULL,FUNCSTR);
     return;
   }
-  if (pElem->sImgRefNorm.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  gslc_tsImgRef* pImgRefNorm = gslc_ElemGetImgRef(NULL,pElem,false,false);
+  gslc_tsImgRef* pImgRefGlow = gslc_ElemGetImgRef(NULL,pElem,true,false);
+  if ((pImgRefNorm != NULL) && (pImgRefNorm->pvImgRaw != NULL)) {
+    gslc_DrvImageDestruct(pImgRefNorm->pvImgRaw);
+    *pImgRefNorm = gslc_ResetImage();
   }
-  if (pElem->sImgRefGlow.pvImgRaw != NULL) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if ((pImgRefGlow != NULL) && (pImgRefGlow->pvImgRaw != NULL)) {
+    gslc_DrvImageDestruct(pImgRefGlow->pvImgRaw);
+    *pImgRefGlow = gslc_ResetImage();
   }
 
   // TODO: Mark Element valid as false?
@@ -5875,6 +7772,20 @@ void gslc_CollectReset(gslc_tsCollect* pCollect,gslc_tsElem* asElem,uint16_t nEl
   // Reset touch / input tracking
   pCollect->pElemRefTracked = NULL;
   pCollect->nElemIndTracked = GSLC_IND_NONE;
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Hit-test index is built on first use
+  pCollect->sHitGrid.bValid = false;
+  #endif
+
+  #if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+  // Reset the ID index
+  pCollect->nIdIndexUsed = 0;
+  pCollect->nIdIndexCnt = 0;
+  for (nInd=0;nInd<GSLC_ID_INDEX_MAX;nInd++) {
+    pCollect->asIdIndex[nInd].nInd = GSLC_ID_INDEX_EMPTY;
+  }
+  #endif
 }
 
 
@@ -5890,6 +7801,7 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
   gslc_tsElemRef*   pElemRef = NULL;
   gslc_tsElemRef*   pFoundElemRef = NULL;
   uint16_t          nInd;
+  uint16_t          nIndStart = 0;
 
   if (nElemId == GSLC_ID_TEMP) {
     // ERROR: Don't expect to do this
@@ -5897,7 +7809,36 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
     return NULL;
   }
 
-  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+  #if (GSLC_ID_INDEX == GSLC_ID_INDEX_SORTED)
+  // Binary search for the first entry with the ID
+  uint16_t nLo = 0;
+  uint16_t nHi = pCollect->nIdIndexUsed;
+  while (nLo < nHi) {
+    uint16_t nMid = nLo + (nHi - nLo) / 2;
+    if (pCollect->asIdIndex[nMid].nId < nElemId) {
+      nLo = nMid + 1;
+    } else {
+      nHi = nMid;
+    }
+  }
+  if ((nLo < pCollect->nIdIndexUsed) && (pCollect->asIdIndex[nLo].nId == nElemId)) {
+    return &(pCollect->asElemRef[pCollect->asIdIndex[nLo].nInd]);
+  }
+  nIndStart = pCollect->nIdIndexCnt;
+  #elif (GSLC_ID_INDEX == GSLC_ID_INDEX_HASH)
+  // Probe from the home slot until the ID or an empty slot is found
+  uint16_t nSlot = gslc_CollectIdHash(nElemId);
+  while (pCollect->asIdIndex[nSlot].nInd != GSLC_ID_INDEX_EMPTY) {
+    if (pCollect->asIdIndex[nSlot].nId == nElemId) {
+      return &(pCollect->asElemRef[pCollect->asIdIndex[nSlot].nInd]);
+    }
+    nSlot = (nSlot+1) & (GSLC_ID_INDEX_MAX-1);
+  }
+  nIndStart = pCollect->nIdIndexCnt;
+  #endif // GSLC_ID_INDEX
+
+  // Search any elements that aren't covered by the ID index
+  for (nInd=nIndStart;nInd<pCollect->nElemRefCnt;nInd++) {
     // Fetch the element pointer from the reference array
     pElemRef = &(pCollect->asElemRef[nInd]);
     pElem = gslc_GetElemFromRef(pGui,pElemRef);
@@ -5949,6 +7890,37 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   *pnElemInd = GSLC_IND_NONE;
 
   if (pCollect->nElemRefCnt == 0) { return NULL; }
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  // Rebuild the hit-test index if elements have been added or changed
+  gslc_tsHitGrid* pGrid = &pCollect->sHitGrid;
+  if ((!pGrid->bValid) || (pGrid->nGen != pGui->nHitGridGen) || (pGrid->nElemRefCnt != pCollect->nElemRefCnt)) {
+    gslc_CollectHitGridBuild(pGui,pCollect);
+  }
+  if (!pGrid->bOvf) {
+    // Only the elements in the touched cell need to be tested
+    if (!gslc_IsInRect(nX,nY,pGrid->rBounds)) {
+      return NULL;
+    }
+    uint8_t   nCol  = (uint8_t)((nX - pGrid->rBounds.x) / pGrid->nCellW);
+    uint8_t   nRow  = (uint8_t)((nY - pGrid->rBounds.y) / pGrid->nCellH);
+    uint16_t  nCell = nRow*GSLC_HIT_GRID_COLS + nCol;
+    uint16_t  nEntry;
+    for (nEntry=pGrid->anCellStart[nCell];nEntry<pGrid->anCellStart[nCell+1];nEntry++) {
+      nInd = pGrid->anCellElem[nEntry];
+      pElemRef = &(pCollect->asElemRef[nInd]);
+      if (!gslc_ElemGetVisible(pGui, pElemRef)) {
+        continue;
+      }
+      if (gslc_ElemOwnsCoord(pGui,pElemRef,nX,nY,true)) {
+        *pnElemInd = nInd;
+        return pElemRef;
+      }
+    }
+    return NULL;
+  }
+  #endif // GSLC_FEATURE_HIT_GRID
+
   for (nInd=pCollect->nElemRefCnt-1;nInd>=0;nInd--) {
     pElemRef  = &(pCollect->asElemRef[nInd]);
 
@@ -5969,6 +7941,122 @@ gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* p
   return pFoundElemRef;
 }
 
+#if (GSLC_FEATURE_HIT_GRID)
+// Determine the range of grid cells covered by a rect
+// - The rect is assumed to lie within the grid bounds
+// - Note that the covered region matches gslc_IsInRect(), which
+//   includes the coordinates (x+w) and (y+h)
+static void gslc_HitGridCellRange(gslc_tsHitGrid* pGrid,gslc_tsRect rRect,
+  uint8_t* pnCol0,uint8_t* pnCol1,uint8_t* pnRow0,uint8_t* pnRow1)
+{
+  *pnCol0 = (uint8_t)((rRect.x - pGrid->rBounds.x) / pGrid->nCellW);
+  *pnCol1 = (uint8_t)((rRect.x + rRect.w - pGrid->rBounds.x) / pGrid->nCellW);
+  *pnRow0 = (uint8_t)((rRect.y - pGrid->rBounds.y) / pGrid->nCellH);
+  *pnRow1 = (uint8_t)((rRect.y + rRect.h - pGrid->rBounds.y) / pGrid->nCellH);
+}
+
+void gslc_CollectHitGridBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect)
+{
+  gslc_tsHitGrid* pGrid = &pCollect->sHitGrid;
+  gslc_tsElem*    pElem;
+  uint16_t        nInd;
+  uint16_t        nCell;
+  uint8_t         nCol,nCol0,nCol1,nRow,nRow0,nRow1;
+  int16_t         nX0 = 0;
+  int16_t         nY0 = 0;
+  int16_t         nX1 = 0;
+  int16_t         nY1 = 0;
+  bool            bFound = false;
+
+  pGrid->bValid       = true;
+  pGrid->bOvf         = false;
+  pGrid->nGen         = pGui->nHitGridGen;
+  pGrid->nElemRefCnt  = pCollect->nElemRefCnt;
+  pGrid->rBounds      = (gslc_tsRect){0,0,0,0};
+  for (nCell=0;nCell<=GSLC_HIT_GRID_COLS*GSLC_HIT_GRID_ROWS;nCell++) {
+    pGrid->anCellStart[nCell] = 0;
+  }
+
+  // Determine the region spanned by the clickable elements
+  // - Elements that are not clickable can never be found by
+  //   gslc_CollectFindElemFromCoord(), so they are left out
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    if ((!pElem) || !(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN)) {
+      continue;
+    }
+    if (!bFound) {
+      nX0 = pElem->rElem.x;
+      nY0 = pElem->rElem.y;
+      nX1 = pElem->rElem.x + pElem->rElem.w;
+      nY1 = pElem->rElem.y + pElem->rElem.h;
+      bFound = true;
+    } else {
+      nX0 = GSLC_MIN(nX0,pElem->rElem.x);
+      nY0 = GSLC_MIN(nY0,pElem->rElem.y);
+      nX1 = GSLC_MAX(nX1,pElem->rElem.x + pElem->rElem.w);
+      nY1 = GSLC_MAX(nY1,pElem->rElem.y + pElem->rElem.h);
+    }
+  }
+  if (!bFound) {
+    // No clickable elements, so every lookup misses the grid bounds
+    return;
+  }
+  // Note that the bounds use the same inclusive (x+w) convention
+  // as gslc_IsInRect(), so the grid spans (w+1) x (h+1) pixels
+  pGrid->rBounds = (gslc_tsRect){nX0,nY0,(uint16_t)(nX1-nX0),(uint16_t)(nY1-nY0)};
+  pGrid->nCellW = (pGrid->rBounds.w + GSLC_HIT_GRID_COLS) / GSLC_HIT_GRID_COLS;
+  pGrid->nCellH = (pGrid->rBounds.h + GSLC_HIT_GRID_ROWS) / GSLC_HIT_GRID_ROWS;
+
+  // Count the number of elements overlapping each cell
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    if ((!pElem) || !(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN)) {
+      continue;
+    }
+    gslc_HitGridCellRange(pGrid,pElem->rElem,&nCol0,&nCol1,&nRow0,&nRow1);
+    for (nRow=nRow0;nRow<=nRow1;nRow++) {
+      for (nCol=nCol0;nCol<=nCol1;nCol++) {
+        pGrid->anCellStart[nRow*GSLC_HIT_GRID_COLS+nCol]++;
+      }
+    }
+  }
+
+  // Convert the counts into the end position of each cell's list
+  for (nCell=1;nCell<GSLC_HIT_GRID_COLS*GSLC_HIT_GRID_ROWS;nCell++) {
+    pGrid->anCellStart[nCell] += pGrid->anCellStart[nCell-1];
+  }
+  nCell = GSLC_HIT_GRID_COLS*GSLC_HIT_GRID_ROWS;
+  pGrid->anCellStart[nCell] = pGrid->anCellStart[nCell-1];
+  if (pGrid->anCellStart[nCell] > GSLC_HIT_GRID_ENTRY_MAX) {
+    #if defined(DBG_LOG)
+    GSLC_DEBUG_PRINT("INFO: CollectHitGridBuild() too many entries (%u/%u), using exhaustive search\n",
+      pGrid->anCellStart[nCell],GSLC_HIT_GRID_ENTRY_MAX);
+    #endif
+    pGrid->bOvf = true;
+    return;
+  }
+
+  // Fill in the lists from the end of each cell
+  // - Since the elements are visited in ascending order, each
+  //   cell's list ends up in descending order (topmost first)
+  //   and the cell end positions become the start positions
+  for (nInd=0;nInd<pCollect->nElemRefCnt;nInd++) {
+    pElem = gslc_GetElemFromRef(pGui,&(pCollect->asElemRef[nInd]));
+    if ((!pElem) || !(pElem->nFeatures & GSLC_ELEM_FEA_CLICK_EN)) {
+      continue;
+    }
+    gslc_HitGridCellRange(pGrid,pElem->rElem,&nCol0,&nCol1,&nRow0,&nRow1);
+    for (nRow=nRow0;nRow<=nRow1;nRow++) {
+      for (nCol=nCol0;nCol<=nCol1;nCol++) {
+        nCell = nRow*GSLC_HIT_GRID_COLS+nCol;
+        pGrid->anCellElem[--pGrid->anCellStart[nCell]] = nInd;
+      }
+    }
+  }
+}
+#endif // GSLC_FEATURE_HIT_GRID
+
 
 #if (GSLC_FEATURE_COMPOUND)
 // Go through all elements in a collection and set the parent
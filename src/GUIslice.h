@@ -68,6 +68,196 @@ extern "C" {
   #define GSLC_FEATURE_FOCUS_ON_TOUCH 1
 #endif
 
+// Provide default for the maximum number of invalidated rects
+// - Distinct regions of the display that are invalidated are tracked
+//   separately (up to this limit) so that a redraw only needs to
+//   cover the areas that have actually changed
+// - Setting this to 1 reverts to a single bounding invalidation rect
+#if !defined(GSLC_INVALIDATE_RGN_MAX)
+  #define GSLC_INVALIDATE_RGN_MAX 4
+#endif
+
+// Provide default for the maximum number of tracked dirty elements
+// - Element references marked as needing redraw are recorded in a
+//   short list so that a redraw only needs to visit those elements
+//   rather than scanning every element on every page in the stack
+// - If more elements are marked than can be tracked, the redraw
+//   falls back to the exhaustive scan for that update
+#if !defined(GSLC_DIRTY_ELEM_MAX)
+  #define GSLC_DIRTY_ELEM_MAX 16
+#endif
+
+// Provide default for the maximum number of elements with tick callbacks
+// - Elements with a tick callback are scheduled individually so that
+//   gslc_Update() only visits the callbacks that are due
+// - If more elements register a tick callback than can be scheduled,
+//   gslc_Update() falls back to ticking every element on every page
+//   (and tick periods are ignored)
+#if !defined(GSLC_TICK_MAX)
+  #define GSLC_TICK_MAX 8
+#endif
+
+// Provide default for runtime statistics collection
+// - When enabled, gslc_tsGui maintains a set of counters describing
+//   the work performed by gslc_Update(), readable via gslc_GetStats()
+#if !defined(GSLC_FEATURE_STATS)
+  #define GSLC_FEATURE_STATS 0
+#endif
+
+// Provide default for the touch hit-test index
+// - When enabled, each collection maintains a uniform grid over its
+//   clickable elements so that gslc_CollectFindElemFromCoord() only
+//   tests the elements in the touched grid cell
+// - The grid is built on first use and rebuilt after elements are
+//   added, moved or have their click state changed
+// - GSLC_HIT_GRID_ENTRY_MAX limits the total number of (element, cell)
+//   entries per collection. A collection that exceeds it falls back
+//   to the exhaustive search.
+#if !defined(GSLC_FEATURE_HIT_GRID)
+  #define GSLC_FEATURE_HIT_GRID 0
+#endif
+#if !defined(GSLC_HIT_GRID_COLS)
+  #define GSLC_HIT_GRID_COLS 4
+#endif
+#if !defined(GSLC_HIT_GRID_ROWS)
+  #define GSLC_HIT_GRID_ROWS 4
+#endif
+#if !defined(GSLC_HIT_GRID_ENTRY_MAX)
+  #define GSLC_HIT_GRID_ENTRY_MAX 64
+#endif
+
+// Provide default for the number of FLASH (PROGMEM) elements cached in RAM
+// - When GSLC_USE_PROGMEM is enabled, elements created with the _P
+//   macros are copied from FLASH into RAM on access. The most recently
+//   accessed elements are retained so that repeated accesses to the
+//   same element skip the copy.
+// - Each entry costs sizeof(gslc_tsElem) of RAM
+#if !defined(GSLC_ELEM_PROG_CACHE_MAX)
+  #define GSLC_ELEM_PROG_CACHE_MAX 1
+#endif
+
+// Element ID lookup index modes (for GSLC_ID_INDEX)
+#define GSLC_ID_INDEX_NONE    0 ///< Linear search by ID (no RAM overhead)
+#define GSLC_ID_INDEX_SORTED  1 ///< Sorted ID array with binary search
+#define GSLC_ID_INDEX_HASH    2 ///< Open-addressing hash table
+
+// Provide default for the element ID lookup index
+// - Selects how gslc_CollectFindElemById() locates elements
+// - Each collection reserves GSLC_ID_INDEX_MAX entries (4 bytes each):
+//   - SORTED: O(log n) lookup, one entry per element
+//   - HASH:   O(1) lookup, slots are only filled to 3/4 so fewer
+//             elements fit. GSLC_ID_INDEX_MAX must be a power of 2.
+// - Elements added after the index is full are found by a linear
+//   search of the remaining elements
+#if !defined(GSLC_ID_INDEX)
+  #define GSLC_ID_INDEX GSLC_ID_INDEX_NONE
+#endif
+#if !defined(GSLC_ID_INDEX_MAX)
+  #define GSLC_ID_INDEX_MAX 32
+#endif
+#if (GSLC_ID_INDEX == GSLC_ID_INDEX_HASH) && (GSLC_ID_INDEX_MAX & (GSLC_ID_INDEX_MAX-1))
+  #error "GSLC_ID_INDEX_MAX must be a power of 2 when GSLC_ID_INDEX is GSLC_ID_INDEX_HASH"
+#endif
+
+// Provide default for the split (hot/cold) element layout
+// - When enabled, the image references and the tick/event callbacks
+//   are moved out of gslc_tsElem into a side record that is only
+//   allocated for elements that use them. This reduces the RAM
+//   consumed by plain elements (boxes, text, buttons).
+// - GSLC_ELEM_COLD_MAX defines the number of side records available
+//   across the whole GUI. It must be at least the number of RAM
+//   elements that hold an image or a tick callback at the same time
+//   (gslc_ElemSetStyleFrom() gives the destination its own record if
+//   the source has one). A record returns to the pool once both
+//   images and the tick callback of its element have been cleared.
+// - Constant elements (ElemCreate*_P) carry their own constant side
+//   record and don't draw from the pool
+// - Not supported with GSLC_USE_PROGMEM as the side record of a
+//   constant element would have to be read back from FLASH
+#if !defined(GSLC_FEATURE_ELEM_COLD)
+  #define GSLC_FEATURE_ELEM_COLD 0
+#endif
+#if !defined(GSLC_ELEM_COLD_MAX)
+  #define GSLC_ELEM_COLD_MAX 4
+#endif
+#if (GSLC_FEATURE_ELEM_COLD) && (GSLC_USE_PROGMEM)
+  #error "CONFIG: GSLC_FEATURE_ELEM_COLD is not compatible with GSLC_USE_PROGMEM"
+#endif
+
+// Provide default for shared style tables
+// - When enabled, elements can reference an entry in a user-provided
+//   gslc_tsStyle table (see gslc_SetStyleTable) instead of their own
+//   colors, so that a theme can be changed with a single table update
+#if !defined(GSLC_FEATURE_STYLE)
+  #define GSLC_FEATURE_STYLE 0
+#endif
+
+// Provide default for popup save-under
+// - When enabled, gslc_PopupShow() captures the display region under
+//   a modal popup into a user-provided buffer (see gslc_PopupSetSaveBuf)
+//   and gslc_PopupHide() restores it instead of redrawing the pages
+//   beneath the popup
+// - Requires a display driver with pixel readback (DRV_HAS_SAVE_RECT).
+//   Otherwise, or if the buffer is too small, the popup is dismissed
+//   with the normal redraw.
+#if !defined(GSLC_FEATURE_POPUP_SAVE_UNDER)
+  #define GSLC_FEATURE_POPUP_SAVE_UNDER 0
+#endif
+
+// Provide default for occlusion culling across the page stack
+// - When enabled, page redraws skip elements that are entirely covered
+//   by an opaque element on a higher page in the stack (eg. a popup)
+// - GSLC_OCCLUDE_RECT_MAX defines the number of opaque rects tracked.
+//   When more opaque elements are present, the largest ones are kept.
+#if !defined(GSLC_FEATURE_OCCLUDE)
+  #define GSLC_FEATURE_OCCLUDE 0
+#endif
+#if !defined(GSLC_OCCLUDE_RECT_MAX)
+  #define GSLC_OCCLUDE_RECT_MAX 4
+#endif
+
+// Provide default for per-element text size caching
+// - When enabled, each element retains the text dimensions reported by
+//   the driver so that redraws of unchanged text can skip the call to
+//   gslc_DrvGetTxtSize(). Changing the string, font, encoding or
+//   alignment discards the cached size.
+// - Text buffers must be updated with gslc_ElemSetTxtStr(). If a buffer
+//   is written directly, call gslc_ElemTxtCacheReset() afterwards.
+// - Read-only elements (ElemCreate*_P) are measured on every redraw
+// - Has no effect with drivers that perform their own text alignment
+//   (DRV_OVERRIDE_TXT_ALIGN)
+#if !defined(GSLC_FEATURE_TXT_SIZE_CACHE)
+  #define GSLC_FEATURE_TXT_SIZE_CACHE 0
+#endif
+
+// Provide default for incremental (character-diff) text redraw
+// - When enabled, elements assigned a buffer with gslc_ElemSetTxtDiffBuf()
+//   retain a copy of their last drawn text. If the text changes to
+//   another string of the same length, an incremental redraw only
+//   repaints the character cells that differ.
+// - Intended for fixed-width fonts (eg. the built-in GLCD font)
+// - Has no effect with drivers that perform their own text alignment
+//   (DRV_OVERRIDE_TXT_ALIGN)
+#if !defined(GSLC_FEATURE_TXT_DIFF)
+  #define GSLC_FEATURE_TXT_DIFF 0
+#endif
+
+// Provide default for word-wrapped text with per-line alignment
+// - When enabled, elements assigned a line table with gslc_ElemSetTxtWrap()
+//   break their text into lines that fit the element width and align
+//   each line individually. The line breaks and widths are retained in
+//   the table so that redraws don't need to measure the text again.
+// - Has no effect with drivers that perform their own text alignment
+//   (DRV_OVERRIDE_TXT_ALIGN)
+#if !defined(GSLC_FEATURE_TXT_WRAP)
+  #define GSLC_FEATURE_TXT_WRAP 0
+#endif
+// - Each line is measured and drawn from a copy in a local buffer of
+//   GSLC_TXT_WRAP_LINE_LEN bytes, which also limits the length of a line
+#if !defined(GSLC_TXT_WRAP_LINE_LEN)
+  #define GSLC_TXT_WRAP_LINE_LEN 48
+#endif
+
 // Ensure that touch/input drivers have not been disabled if FEATURE_INPUT has been requested
 // - Either use DRV_TOUCH_INPUT if no touch-screen is used (but external pins are being used)
 // - Or select a DRV_TOUCH_* driver specific to the touch-screen device
@@ -187,6 +377,7 @@ typedef enum {
 } gslc_teTypeCore;
 
 /// Element features type
+#define GSLC_ELEM_FEA_OPAQUE    0x0200      ///< Element drawing always covers the element rect
 #define GSLC_ELEM_FEA_NOSHRINK  0x0100      ///< Element can't be shrunk (eg. contains image)
 #define GSLC_ELEM_FEA_VALID     0x0080      ///< Element record is valid
 #define GSLC_ELEM_FEA_FOCUS_EN  0x0040      ///< Element can accept focus
@@ -507,6 +698,36 @@ typedef enum {
   GSLC_TXT_DEFAULT        = GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_NONE | GSLC_TXT_ENC_PLAIN,
 } gslc_teTxtFlags;
 
+/// Driver primitive types counted in gslc_tsStats
+typedef enum {
+  GSLC_STAT_DRV_POINT,              ///< gslc_DrvDrawPoint()
+  GSLC_STAT_DRV_POINTS,             ///< gslc_DrvDrawPoints()
+  GSLC_STAT_DRV_LINE,               ///< gslc_DrvDrawLine()
+  GSLC_STAT_DRV_RECT_FRAME,         ///< gslc_DrvDrawFrameRect()
+  GSLC_STAT_DRV_RECT_FILL,          ///< gslc_DrvDrawFillRect()
+  GSLC_STAT_DRV_RECT_ROUND_FRAME,   ///< gslc_DrvDrawFrameRoundRect()
+  GSLC_STAT_DRV_RECT_ROUND_FILL,    ///< gslc_DrvDrawFillRoundRect()
+  GSLC_STAT_DRV_CIRCLE_FRAME,       ///< gslc_DrvDrawFrameCircle()
+  GSLC_STAT_DRV_CIRCLE_FILL,        ///< gslc_DrvDrawFillCircle()
+  GSLC_STAT_DRV_TRI_FRAME,          ///< gslc_DrvDrawFrameTriangle()
+  GSLC_STAT_DRV_TRI_FILL,           ///< gslc_DrvDrawFillTriangle()
+  GSLC_STAT_DRV_TEXT,               ///< gslc_DrvDrawTxt() / gslc_DrvDrawTxtAlign()
+  GSLC_STAT_DRV_IMAGE,              ///< gslc_DrvDrawImage()
+  GSLC_STAT_DRV_BKGND,              ///< gslc_DrvDrawBkgnd()
+  GSLC_STAT_DRV_COPY_RECT,          ///< gslc_DrvCopyRect()
+  // Terminator
+  GSLC_STAT_DRV__MAX
+} gslc_teStatDrv;
+
+/// Phases of gslc_Update() timed in gslc_tsStats
+typedef enum {
+  GSLC_STAT_PHASE_INPUT,            ///< Pending event, touch and input handling
+  GSLC_STAT_PHASE_TICK,             ///< Timer tick dispatch to all pages
+  GSLC_STAT_PHASE_REDRAW,           ///< Page redraw (including page flip)
+  // Terminator
+  GSLC_STAT_PHASE__MAX
+} gslc_teStatPhase;
+
 
 // -----------------------------------------------------------------------
 // Forward declarations
@@ -584,6 +805,47 @@ typedef struct gslc_tsRectState {
   gslc_tsColor colTxtBack;
 } gslc_tsRectState;
 
+#if (GSLC_FEATURE_STYLE)
+/// Style ID indicating that an element uses its own colors
+#define GSLC_STYLE_NONE 0
+
+/// Shared element style (GSLC_FEATURE_STYLE)
+/// - Style IDs 1..N refer to entries 0..N-1 of the table
+///   provided to gslc_SetStyleTable()
+typedef struct gslc_tsStyle {
+  gslc_tsColor colFrame;      ///< Color for frame
+  gslc_tsColor colFill;       ///< Color for background fill
+  gslc_tsColor colFrameGlow;  ///< Color to use for frame when glowing
+  gslc_tsColor colFillGlow;   ///< Color to use for fill when glowing
+  gslc_tsColor colText;       ///< Color of overlay text
+  gslc_tsColor colTextGlow;   ///< Color of overlay text when glowing
+} gslc_tsStyle;
+#endif // GSLC_FEATURE_STYLE
+
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+/// Cached text dimensions (GSLC_FEATURE_TXT_SIZE_CACHE)
+/// - Holds the result of the last gslc_DrvGetTxtSize() call
+///   for an element's text string
+typedef struct {
+  int16_t   nOffsetX;     ///< Text X offset returned by driver
+  int16_t   nOffsetY;     ///< Text Y offset returned by driver
+  uint16_t  nSzW;         ///< Text width
+  uint16_t  nSzH;         ///< Text height
+  bool      bValid;       ///< Cached dimensions are valid
+} gslc_tsTxtSize;
+#endif // GSLC_FEATURE_TXT_SIZE_CACHE
+
+#if (GSLC_FEATURE_TXT_WRAP)
+/// Layout of a line of word-wrapped text (GSLC_FEATURE_TXT_WRAP)
+typedef struct {
+  uint16_t  nStart;       ///< Offset of the first character of the line
+  uint16_t  nLen;         ///< Number of characters in the line
+  uint16_t  nW;           ///< Width of the line
+  int16_t   nOffsetX;     ///< Text X offset returned by driver
+  int16_t   nOffsetY;     ///< Text Y offset returned by driver
+} gslc_tsTxtLine;
+#endif // GSLC_FEATURE_TXT_WRAP
+
 /// Event structure
 typedef struct gslc_tsEvent {
   gslc_teEventType  eType;    ///< Event type
@@ -627,6 +889,19 @@ typedef struct {
   gslc_teElemRefFlags   eElemFlags; ///< Element reference flags
 } gslc_tsElemRef;
 
+#if (GSLC_FEATURE_ELEM_COLD)
+/// Infrequently used element state (GSLC_FEATURE_ELEM_COLD)
+/// - Only allocated for elements that reference images or
+///   register a tick callback
+/// - Records are taken from gslc_tsGui::asElemCold[]
+typedef struct gslc_tsElemCold {
+  gslc_tsImgRef       sImgRefNorm;      ///< Image reference to draw (normal)
+  gslc_tsImgRef       sImgRefGlow;      ///< Image reference to draw (glowing)
+  GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for event tree (draw,touch,tick)
+  GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+} gslc_tsElemCold;
+#endif
+
 ///
 /// Element Struct
 /// - Represents a single graphic element in the GUIslice environment
@@ -651,8 +926,12 @@ typedef struct gslc_tsElem {
   gslc_tsColor        colElemFrameGlow; ///< Color to use for frame when glowing
   gslc_tsColor        colElemFillGlow;  ///< Color to use for fill when glowing
 
+#if (GSLC_FEATURE_ELEM_COLD)
+  gslc_tsElemCold*    pElemCold;        ///< Ptr to infrequently used state (NULL if none)
+#else
   gslc_tsImgRef       sImgRefNorm;      ///< Image reference to draw (normal)
   gslc_tsImgRef       sImgRefGlow;      ///< Image reference to draw (glowing)
+#endif
 
   // if (GSLC_FEATURE_COMPOUND)
   /// Parent element reference. Used during redraw
@@ -672,6 +951,13 @@ typedef struct gslc_tsElem {
   char*               pStrBuf;          ///< Ptr to text string buffer to overlay
 #endif
   uint8_t             nStrBufMax;       ///< Size of string buffer
+#if (GSLC_FEATURE_STYLE)
+  // NOTE: Placed in the alignment gap ahead of eTxtFlags so that
+  //       the style ID doesn't grow the element on 16/32-bit targets.
+  //       The ElemCreate*_P() function macros initialize it through
+  //       GSLC_ELEM_INIT_STYLE_P.
+  uint8_t             nStyle;           ///< Shared style ID (or GSLC_STYLE_NONE to use own colors)
+#endif
   gslc_teTxtFlags     eTxtFlags;        ///< Flags associated with text buffer
 
 
@@ -686,16 +972,77 @@ typedef struct gslc_tsElem {
   void*               pXData;           ///< Ptr to extended data structure
 
   // Callback functions
+#if !(GSLC_FEATURE_ELEM_COLD)
   GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for event tree (draw,touch,tick)
+#endif
 
   GSLC_CB_DRAW        pfuncXDraw;       ///< Callback func ptr for custom drawing
   GSLC_CB_TOUCH       pfuncXTouch;      ///< Callback func ptr for touch
+#if !(GSLC_FEATURE_ELEM_COLD)
   GSLC_CB_TICK        pfuncXTick;       ///< Callback func ptr for timer/main loop tick
+#endif
+
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  // NOTE: The ElemCreate*_P() function macros initialize this
+  //       field through GSLC_ELEM_INIT_TXT_SIZE_P (cache invalid)
+  gslc_tsTxtSize      sTxtSize;         ///< Cached dimensions of the text string
+#endif
+#if (GSLC_FEATURE_TXT_DIFF)
+  // NOTE: The ElemCreate*_P() function macros initialize these
+  //       fields through GSLC_ELEM_INIT_TXT_DIFF_P (disabled)
+  char*               pTxtDiffBuf;      ///< Copy of the last drawn text string (NULL if disabled)
+  uint8_t             nTxtDiffBufMax;   ///< Size of pTxtDiffBuf (including terminator)
+  gslc_tsColor        colTxtDiffFore;   ///< Text color of the last drawn text
+  gslc_tsColor        colTxtDiffBack;   ///< Fill color of the last drawn text
+  gslc_tsColor        colTxtDiffFrame;  ///< Frame color of the last drawn text
+  bool                bTxtDiffPend;     ///< Text has changed since the element was last drawn
+#endif
+#if (GSLC_FEATURE_TXT_WRAP)
+  // NOTE: The ElemCreate*_P() function macros initialize these
+  //       fields through GSLC_ELEM_INIT_TXT_WRAP_P (disabled)
+  gslc_tsTxtLine*     asTxtLine;        ///< Line table for word-wrapped text (NULL if disabled)
+  uint8_t             nTxtLineMax;      ///< Maximum number of lines in asTxtLine
+  uint8_t             nTxtLineCnt;      ///< Number of lines in the current layout
+  uint16_t            nTxtLineH;        ///< Line height in the current layout
+  uint16_t            nTxtLineWrapW;    ///< Width used for the current layout
+  bool                bTxtLineValid;    ///< Current layout is valid
+#endif
 } gslc_tsElem;
 
 
 
 
+#if (GSLC_FEATURE_HIT_GRID)
+/// Collection hit-test index (GSLC_FEATURE_HIT_GRID)
+/// - Divides the bounding rect of the clickable elements in a collection
+///   into a uniform grid. Each cell lists the elements that overlap it
+///   in descending element index order (ie. topmost element first).
+/// - The cell lists are stored consecutively in anCellElem[], with
+///   cell N occupying [anCellStart[N], anCellStart[N+1])
+typedef struct {
+  bool                  bValid;           ///< Index has been built
+  bool                  bOvf;             ///< Too many entries to index (use exhaustive search)
+  uint16_t              nGen;             ///< Value of gslc_tsGui::nHitGridGen when built
+  uint16_t              nElemRefCnt;      ///< Number of element references when built
+  gslc_tsRect           rBounds;          ///< Region covered by the grid
+  uint16_t              nCellW;           ///< Width of a grid cell
+  uint16_t              nCellH;           ///< Height of a grid cell
+  uint16_t              anCellStart[GSLC_HIT_GRID_COLS*GSLC_HIT_GRID_ROWS+1]; ///< Start of each cell's list
+  uint16_t              anCellElem[GSLC_HIT_GRID_ENTRY_MAX]; ///< Element indices for all cells
+} gslc_tsHitGrid;
+#endif // GSLC_FEATURE_HIT_GRID
+
+#if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+/// Marks an unused entry in a hashed ID index
+#define GSLC_ID_INDEX_EMPTY   0xFFFF
+
+/// Element ID lookup index entry (GSLC_ID_INDEX)
+typedef struct {
+  int16_t               nId;              ///< Element ID
+  uint16_t              nInd;             ///< Index into the collection's element references
+} gslc_tsIdIndex;
+#endif // GSLC_ID_INDEX
+
 /// Element collection struct
 /// - Collections are used to maintain a list of elements and any
 ///   touch tracking status.
@@ -716,6 +1063,17 @@ typedef struct {
   gslc_tsElemRef*       pElemRefTracked;  ///< Element reference currently being touch-tracked (NULL for none)
   int16_t               nElemIndTracked;  ///< Element index currently being touch-tracked (GSLC_IND_NONE for none)
 
+  #if (GSLC_FEATURE_HIT_GRID)
+  gslc_tsHitGrid        sHitGrid;         ///< Hit-test index for touch tracking
+  #endif
+
+  #if (GSLC_ID_INDEX != GSLC_ID_INDEX_NONE)
+  // Element ID lookup
+  gslc_tsIdIndex        asIdIndex[GSLC_ID_INDEX_MAX]; ///< ID index (sorted by ID, or hashed)
+  uint16_t              nIdIndexUsed;     ///< Number of entries in use in asIdIndex
+  uint16_t              nIdIndexCnt;      ///< Number of leading element references covered by asIdIndex
+  #endif
+
   // Callback functions
   //GSLC_CB_EVENT         pfuncXEvent;      ///< UNUSED: Callback func ptr for events
 
@@ -757,6 +1115,35 @@ typedef struct {
 } gslc_tsInputMap;
 
 
+/// Runtime statistics (GSLC_FEATURE_STATS)
+/// - Counters accumulate from gslc_Init() or the last gslc_ResetStats()
+/// - Counters are free-running and wrap on overflow
+typedef struct {
+  uint32_t            nUpdateCnt;       ///< Number of gslc_Update() calls
+  uint32_t            nRedrawCnt;       ///< Number of page redraws performed
+  uint32_t            nInputEvtCnt;     ///< Touch / input events drained
+  uint32_t            nTickEvtCnt;      ///< Tick callbacks dispatched to elements
+  uint32_t            nElemDrawFull;    ///< Elements redrawn in full
+  uint32_t            nElemDrawInc;     ///< Elements redrawn incrementally
+  uint32_t            nElemDrawFocus;   ///< Elements redrawn for focus change only
+  uint32_t            anDrvCall[GSLC_STAT_DRV__MAX]; ///< Driver primitive calls by type
+  uint32_t            nPixelFill;       ///< Pixels requested by rect and background fills
+  uint32_t            anPhaseUs[GSLC_STAT_PHASE__MAX]; ///< Microseconds spent in each gslc_Update() phase
+  uint32_t            nElemProgHit;     ///< FLASH element accesses served from the RAM cache
+  uint32_t            nElemProgMiss;    ///< FLASH element accesses that required a copy from FLASH
+  uint32_t            nElemOcclude;     ///< Element draws skipped as covered by a higher page
+  uint32_t            nTxtDiffCell;     ///< Text character cells redrawn by incremental text redraw
+} gslc_tsStats;
+
+/// Tick schedule entry
+/// - Elements with a tick callback are kept in a min-heap
+///   ordered by the time that their next tick is due
+typedef struct {
+  gslc_tsElemRef*     pElemRef;         ///< Element reference with the tick callback
+  uint16_t            nPeriod;          ///< Tick period (ms), or 0 to tick on every gslc_Update()
+  uint32_t            nTimeDue;         ///< Time (ms) that the next tick is due
+} gslc_tsTick;
+
 /// GUI structure
 /// - Contains all GUI state and content
 /// - Maintains list of one or more pages
@@ -798,7 +1185,14 @@ typedef struct {
   gslc_tsElemRef      sElemRefTmp;      ///< Temporary element reference
 #endif
 
-  gslc_tsElem         sElemTmpProg;     ///< Temporary element for Flash compatibility
+#if (GSLC_USE_PROGMEM)
+  // Cache of FLASH elements copied into RAM
+  // - Note that modifications to a cached copy are not written back
+  //   to FLASH and may be discarded at any time
+  gslc_tsElem         asElemTmpProg[GSLC_ELEM_PROG_CACHE_MAX];    ///< RAM copies of FLASH elements
+  const gslc_tsElem*  apElemTmpProgSrc[GSLC_ELEM_PROG_CACHE_MAX]; ///< FLASH address of each cached element (NULL if unused)
+  uint8_t             nElemTmpProgNext; ///< Next cache entry to replace
+#endif
 
   gslc_teInitStat     eInitStatTouch;   ///< Status of touch initialization
   // TODO: exclude these in DRV_TOUCH_NONE
@@ -827,8 +1221,12 @@ typedef struct {
   // Primary surface definitions
   gslc_tsImgRef       sImgRefBkgnd;     ///< Image reference for background
 
-  uint8_t             nFrameRateCnt;    ///< Diagnostic frame rate count
-  uint8_t             nFrameRateStart;  ///< Diagnostic frame rate timestamp
+  uint16_t            nFrameRateCnt;    ///< Diagnostic frame rate count
+  uint32_t            nFrameRateStart;  ///< Diagnostic frame rate timestamp
+
+  #if (GSLC_FEATURE_STATS)
+  gslc_tsStats        sStats;           ///< Runtime statistics
+  #endif
 
 
   // Pages
@@ -846,7 +1244,58 @@ typedef struct {
 
   // Current clip region
   bool                bInvalidateEn;     ///< A region of the display has been invalidated
-  gslc_tsRect         rInvalidateRect;   ///< The rect region that has been invalidated
+  gslc_tsRect         rInvalidateRect;   ///< The bounding rect of all regions that have been invalidated
+  gslc_tsRect         asInvalidateRect[GSLC_INVALIDATE_RGN_MAX]; ///< List of non-overlapping invalidated rects
+  uint8_t             nInvalidateRectCnt; ///< Number of rects in asInvalidateRect
+  bool                bRedrawRectEn;     ///< Current redraw pass is limited to rRedrawRect
+  gslc_tsRect         rRedrawRect;       ///< The rect region of the current redraw pass
+
+  // Elements requiring redraw
+  gslc_tsElemRef*     apDirtyElemRef[GSLC_DIRTY_ELEM_MAX]; ///< Element references marked as needing redraw
+  uint8_t             nDirtyElemCnt;     ///< Number of entries in apDirtyElemRef
+  bool                bDirtyElemOvf;     ///< More elements were marked than apDirtyElemRef could track
+
+  // Tick scheduling
+  gslc_tsTick         asTick[GSLC_TICK_MAX]; ///< Min-heap of scheduled element ticks
+  uint8_t             nTickCnt;          ///< Number of entries in asTick
+  bool                bTickOvf;          ///< More elements have tick callbacks than asTick could track
+
+  #if (GSLC_FEATURE_ELEM_COLD)
+  gslc_tsElemCold     asElemCold[GSLC_ELEM_COLD_MAX]; ///< Pool of element side records
+  bool                abElemColdUsed[GSLC_ELEM_COLD_MAX]; ///< Side records currently assigned to an element
+  uint16_t            nElemColdCnt;      ///< Number of side records allocated from asElemCold
+  #endif
+
+  #if (GSLC_FEATURE_STYLE)
+  gslc_tsStyle*       asStyle;           ///< User-provided table of shared styles
+  uint8_t             nStyleCnt;         ///< Number of entries in asStyle
+  #endif
+
+  #if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+  void*               pvSaveBuf;         ///< User-provided buffer for the region under a popup
+  uint32_t            nSaveBufSize;      ///< Size of pvSaveBuf (in bytes)
+  gslc_tsRect         rSaveRect;         ///< Display region held in pvSaveBuf
+  bool                bSavePend;         ///< Region saved but popup not yet drawn
+  bool                bSaveValid;        ///< Region saved and still matches the pages beneath the popup
+  #endif
+
+  #if (GSLC_FEATURE_OCCLUDE)
+  gslc_tsRect         asOccludeRect[GSLC_OCCLUDE_RECT_MAX]; ///< Opaque element rects on pages above the base
+  uint8_t             anOccludeStack[GSLC_OCCLUDE_RECT_MAX]; ///< Stack position of each opaque rect
+  uint8_t             nOccludeCnt;       ///< Number of entries in asOccludeRect
+  bool                bOccludeValid;     ///< Opaque rects match the current page stack
+  uint8_t             nOccludeStackPage; ///< Stack position being drawn (GSLC_STACK__MAX if none)
+  #endif
+
+  #if (GSLC_FEATURE_TXT_DIFF)
+  bool                bDrawPassEn;       ///< A redraw pass is in progress
+  bool                bDrawPassDirty;    ///< The current redraw pass is drawing from apDirtyElemRef
+  uint8_t             nDrawPassDirtyInd; ///< Entry in apDirtyElemRef being drawn
+  #endif
+
+  #if (GSLC_FEATURE_HIT_GRID)
+  uint16_t            nHitGridGen;       ///< Incremented when any element hit-test region changes
+  #endif
 
   // Callback functions
   //GSLC_CB_EVENT       pfuncXEvent;      ///< UNUSED: Callback func ptr for events
@@ -878,6 +1327,18 @@ typedef struct {
 } gslc_tsGui;
 
 
+// Update the runtime statistics (GSLC_FEATURE_STATS)
+// - These compile away to nothing when the feature is disabled
+#if (GSLC_FEATURE_STATS)
+  #define GSLC_STATS_INC(pGui,nField)       ((pGui)->sStats.nField++)
+  #define GSLC_STATS_ADD(pGui,nField,nVal)  ((pGui)->sStats.nField += (nVal))
+  #define GSLC_STATS_DRV(pGui,eType)        ((pGui)->sStats.anDrvCall[eType]++)
+#else
+  #define GSLC_STATS_INC(pGui,nField)       ((void)0)
+  #define GSLC_STATS_ADD(pGui,nField,nVal)  ((void)0)
+  #define GSLC_STATS_DRV(pGui,eType)        ((void)0)
+#endif
+
 #define GSLC_MIN(a,b) (a<b)?a:b
 #define GSLC_MAX(a,b) (a>b)?a:b
 
@@ -1026,6 +1487,31 @@ void gslc_Quit(gslc_tsGui* pGui);
 void gslc_Update(gslc_tsGui* pGui);
 
 
+///
+/// Fetch the runtime statistics
+/// - Provides the counters accumulated since gslc_Init()
+///   or the last call to gslc_ResetStats()
+/// - Requires GSLC_FEATURE_STATS
+///
+/// \param[in]  pGui:    Pointer to GUI
+/// \param[out] pStats:  Ptr to statistics to fill in
+///
+/// \return true if success, false if statistics are not enabled
+///
+bool gslc_GetStats(gslc_tsGui* pGui,gslc_tsStats* pStats);
+
+
+///
+/// Reset the runtime statistics to zero
+/// - Requires GSLC_FEATURE_STATS
+///
+/// \param[in]  pGui:    Pointer to GUI
+///
+/// \return None
+///
+void gslc_ResetStats(gslc_tsGui* pGui);
+
+
 ///
 /// Configure the background to use a bitmap image
 /// - The background is used when redrawing the entire page
@@ -1061,6 +1547,33 @@ bool gslc_SetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
 ///
 bool gslc_SetTransparentColor(gslc_tsGui* pGui,gslc_tsColor nCol);
 
+#if (GSLC_FEATURE_STYLE)
+///
+/// Assign the table of shared styles that elements can reference
+/// - The table is owned by the user and must remain valid
+///   for the lifetime of the GUI
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asStyle:     Array of styles (style ID N uses asStyle[N-1])
+/// \param[in]  nStyleCnt:   Number of entries in asStyle
+///
+/// \return none
+///
+void gslc_SetStyleTable(gslc_tsGui* pGui,gslc_tsStyle* asStyle,uint8_t nStyleCnt);
+
+///
+/// Update an entry in the shared style table
+/// - All elements referencing the style will be redrawn
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nStyleId:    Style ID to update (1..nStyleCnt)
+/// \param[in]  sStyle:      New style definition
+///
+/// \return true if success, false if the style ID is invalid
+///
+bool gslc_SetStyle(gslc_tsGui* pGui,uint8_t nStyleId,gslc_tsStyle sStyle);
+#endif // GSLC_FEATURE_STYLE
+
 ///
 /// Get the current the clipping rectangle
 ///
@@ -1133,6 +1646,16 @@ gslc_tsRect gslc_ExpandRect(gslc_tsRect rRect,int16_t nExpandW,int16_t nExpandH)
 ///
 bool gslc_IsInWH(int16_t nSelX,int16_t nSelY,uint16_t nWidth,uint16_t nHeight);
 
+///
+/// Determine if two rects overlap
+///
+/// \param[in]  rRect1:      First rectangle
+/// \param[in]  rRect2:      Second rectangle
+///
+/// \return true if the rects share at least one pixel, false otherwise
+///
+bool gslc_IsRectOverlap(gslc_tsRect rRect1,gslc_tsRect rRect2);
+
 ///
 /// Expand a rect to include another rect
 /// - This routine can be useful to modify an invalidation region to
@@ -1176,6 +1699,11 @@ void gslc_InvalidateRgnScreen(gslc_tsGui* pGui);
 ///
 /// Add a rectangular region to the invalidation region
 /// - This is usually called when an element has been modified
+/// - The region is kept as a short list of non-overlapping rects
+///   (up to GSLC_INVALIDATE_RGN_MAX). Rects that overlap, or that
+///   would cost no more to redraw as a single union, are merged.
+///   When the list is full, the pair with the least wasted area
+///   is merged.
 ///
 /// \param[in]  pGui:     Pointer to GUI
 /// \param[in]  rAddRect: Rectangle to add to the invalidation region
@@ -1803,6 +2331,24 @@ void gslc_PopupShow(gslc_tsGui* pGui, int16_t nPageId, bool bModal);
 void gslc_PopupHide(gslc_tsGui* pGui);
 
 
+#if (GSLC_FEATURE_POPUP_SAVE_UNDER)
+///
+/// Assign the buffer used to save the display region under a popup
+/// - The buffer must hold the popup page bounds at the display
+///   driver's pixel size (eg. 2 bytes per pixel for RGB565)
+/// - Only modal popups are saved, as modeless popups allow the
+///   pages beneath them to continue drawing
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvBuf:       Pointer to buffer (or NULL to disable)
+/// \param[in]  nBufSize:    Size of buffer (in bytes)
+///
+/// \return none
+///
+void gslc_PopupSetSaveBuf(gslc_tsGui* pGui, void* pvBuf, uint32_t nBufSize);
+#endif // GSLC_FEATURE_POPUP_SAVE_UNDER
+
+
 ///
 /// Update the need-redraw status for the current page
 ///
@@ -1850,6 +2396,28 @@ bool gslc_PageRedrawGet(gslc_tsGui* pGui);
 void gslc_PageAdd(gslc_tsGui* pGui,int16_t nPageId,gslc_tsElem* psElem,uint16_t nMaxElem,
         gslc_tsElemRef* psElemRef,uint16_t nMaxElemRef);
 
+/// Add a page whose element references have been defined at compile time
+/// - The definition table is declared as a static const gslc_tsElemRef
+///   array (in PROGMEM if enabled) initialized with gslc_ElemRefInit_P()
+///   entries (eg. as generated by a GUI builder). No elements are copied
+///   and no calls to gslc_ElemAdd() are required.
+/// - The definitions are loaded into psElemRef, which must reside in RAM
+///   as it tracks the per-element state (redraw, glow, visibility).
+///   The elements and the definition table can remain in FLASH.
+/// - No further elements can be added to the page
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  nPageId:      Page ID to assign
+/// \param[in]  psElemRefDef: Read-only element reference definition table
+/// \param[in]  psElemRef:    Element reference array (RAM) with at least
+///                           nElemRefCnt entries
+/// \param[in]  nElemRefCnt:  Number of entries in psElemRefDef
+///
+/// \return true if success, false if fail
+///
+bool gslc_PageAddStatic(gslc_tsGui* pGui,int16_t nPageId,const gslc_tsElemRef* psElemRefDef,
+  gslc_tsElemRef* psElemRef,uint16_t nElemRefCnt);
+
 /// Find an element in the GUI by its Page ID and Element ID
 ///
 /// \param[in]  pGui:         Pointer to GUI
@@ -2177,6 +2745,9 @@ void gslc_StrCopy(char* pDstStr,const char* pSrcStr,uint16_t nDstLen);
 
 ///
 /// Update the text string associated with an Element
+/// - Text buffers should be updated through this function rather than
+///   written directly, as it also discards any cached text measurements
+///   (see gslc_ElemTxtCacheReset)
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  pElemRef:    Pointer to Element reference
@@ -2186,6 +2757,20 @@ void gslc_StrCopy(char* pDstStr,const char* pSrcStr,uint16_t nDstLen);
 ///
 void gslc_ElemSetTxtStr(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,const char* pStr);
 
+///
+/// Discard any cached measurements of an Element's text
+/// - Only required if the text buffer has been modified directly
+///   (ie. not through gslc_ElemSetTxtStr) while
+///   GSLC_FEATURE_TXT_SIZE_CACHE or GSLC_FEATURE_TXT_WRAP is enabled
+/// - Doesn't request a redraw of the element
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return none
+///
+void gslc_ElemTxtCacheReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
 
 ///
 /// Fetch the current text string associated with an Element
@@ -2235,6 +2820,50 @@ void gslc_ElemSetTxtMem(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlag
 ///
 void gslc_ElemSetTxtEnc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teTxtFlags eFlags);
 
+#if (GSLC_FEATURE_TXT_DIFF)
+///
+/// Enable incremental (character-diff) text redraw for an element
+/// - Intended for elements that use a fixed-width font and frequently
+///   change their text, such as numeric readouts
+/// - When the text changes to another string of the same length,
+///   an incremental redraw only fills and redraws the character cells
+///   that differ. Otherwise the element is redrawn in full.
+/// - The element must have fill enabled (and rounded corners disabled)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  pBuf:        Buffer to retain the last drawn string (or NULL to disable).
+///                          Should be at least as large as the element's text buffer.
+/// \param[in]  nBufMax:     Size of the buffer (including terminator)
+///
+/// \return none
+///
+void gslc_ElemSetTxtDiffBuf(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pBuf,uint8_t nBufMax);
+#endif // GSLC_FEATURE_TXT_DIFF
+
+#if (GSLC_FEATURE_TXT_WRAP)
+///
+/// Enable word-wrapped text with per-line alignment for an element
+/// - The text is broken into lines at spaces (or within a word that
+///   is too long for a line) so that each line fits within the element
+///   width less the text margins. Newlines start a new line.
+/// - Each line is aligned horizontally according to the element's text
+///   alignment, and the block of lines is aligned vertically
+/// - Text beyond nLineMax lines is not drawn
+/// - Lines are limited to GSLC_TXT_WRAP_LINE_LEN-1 characters
+/// - The text string must reside in RAM (it isn't modified, so it
+///   may be a string literal)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  asLine:      Table to retain the line layout (or NULL to disable)
+/// \param[in]  nLineMax:    Maximum number of lines in the table
+///
+/// \return none
+///
+void gslc_ElemSetTxtWrap(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsTxtLine* asLine,uint8_t nLineMax);
+#endif // GSLC_FEATURE_TXT_WRAP
+
 
 ///
 /// Update the Font selected for an Element's text
@@ -2312,6 +2941,22 @@ void gslc_ElemSetTouchFunc(gslc_tsGui* pGui, gslc_tsElemRef* pElemRef, GSLC_CB_T
 ///
 void gslc_ElemSetStyleFrom(gslc_tsGui* pGui,gslc_tsElemRef* pElemRefSrc,gslc_tsElemRef* pElemRefDest);
 
+#if (GSLC_FEATURE_STYLE)
+///
+/// Assign a shared style to an element
+/// - The element's colors are resolved through the style table
+///   until the style is cleared or an element color is set
+///   directly (eg. via gslc_ElemSetCol)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nStyleId:    Style ID (1..nStyleCnt) or GSLC_STYLE_NONE
+///
+/// \return none
+///
+void gslc_ElemSetStyle(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t nStyleId);
+#endif // GSLC_FEATURE_STYLE
+
 ///
 /// Reset the element region state struct
 ///
@@ -2541,6 +3186,22 @@ void gslc_ElemSetDrawFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_DRAW
 ///
 void gslc_ElemSetTickFunc(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,GSLC_CB_TICK funcCb);
 
+///
+/// Set the period between calls to an element's tick callback
+/// - By default, the tick callback is called on every gslc_Update()
+/// - Setting a period allows gslc_Update() to skip the callback
+///   until the period has elapsed
+/// - Has no effect unless a tick callback has been assigned
+///   (eg. with gslc_ElemSetTickFunc())
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nPeriod:     Minimum time between ticks (ms), or 0 for every update
+///
+/// \return none
+///
+void gslc_ElemSetTickPeriod(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriod);
+
 
 ///
 /// Determine if a coordinate is inside of an element
@@ -2866,9 +3527,141 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 // - Unlike the normal ElemCreate*() functions, these ElemCreate*_P() macros
 //   don't return a tsElem pointer. Since the element definition is in
 //   Flash/PROGMEM, it is read-only and no updates should be attempted.
-// - These macros have to match the current definition and order of gslc_tsElem
-//   exactly, so any changes to the element definition must be reflected here
-//   as well.
+// - The element initializer is provided by gslc_ElemDefine_P(). Its
+//   designated initializers must list the gslc_tsElem fields in declaration
+//   order (as C++ requires), so any changes to the element definition must
+//   be reflected there as well.
+
+
+/// Image reference initializer for read-only elements without an image
+#define GSLC_IMGREF_INIT_NONE ((gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL})
+
+// Initializers for the optional element fields (used by gslc_ElemDefine_P)
+// - Read-only elements are created without a shared style and with the
+//   text caches, incremental text redraw and word wrap disabled
+#if (GSLC_FEATURE_STYLE)
+  #define GSLC_ELEM_INIT_STYLE_P      .nStyle = GSLC_STYLE_NONE,
+#else
+  #define GSLC_ELEM_INIT_STYLE_P
+#endif
+#if (GSLC_FEATURE_TXT_SIZE_CACHE)
+  #define GSLC_ELEM_INIT_TXT_SIZE_P   .sTxtSize = {0,0,0,0,false},
+#else
+  #define GSLC_ELEM_INIT_TXT_SIZE_P
+#endif
+#if (GSLC_FEATURE_TXT_DIFF)
+  #define GSLC_ELEM_INIT_TXT_DIFF_P   .pTxtDiffBuf = NULL, .nTxtDiffBufMax = 0, \
+    .colTxtDiffFore = GSLC_COL_BLACK, .colTxtDiffBack = GSLC_COL_BLACK, \
+    .colTxtDiffFrame = GSLC_COL_BLACK, .bTxtDiffPend = false,
+#else
+  #define GSLC_ELEM_INIT_TXT_DIFF_P
+#endif
+#if (GSLC_FEATURE_TXT_WRAP)
+  #define GSLC_ELEM_INIT_TXT_WRAP_P   .asTxtLine = NULL, .nTxtLineMax = 0, .nTxtLineCnt = 0, \
+    .nTxtLineH = 0, .nTxtLineWrapW = 0, .bTxtLineValid = false,
+#else
+  #define GSLC_ELEM_INIT_TXT_WRAP_P
+#endif
+
+// Initializers for the fields that GSLC_FEATURE_ELEM_COLD moves
+// into the side record (used by gslc_ElemDefine_P)
+#if (GSLC_FEATURE_ELEM_COLD)
+  #define GSLC_ELEM_DEF_COLD_P(sElem_,sImgRefNorm_,sImgRefGlow_,pfuncXEvent_,pfuncXTick_) \
+    static const gslc_tsElemCold sElem_##Cold = {                   \
+      .sImgRefNorm  = sImgRefNorm_,                                 \
+      .sImgRefGlow  = sImgRefGlow_,                                 \
+      .pfuncXEvent  = pfuncXEvent_,                                 \
+      .pfuncXTick   = pfuncXTick_,                                  \
+    };
+  #define GSLC_ELEM_INIT_IMG_P(sElem_,sImgRefNorm_,sImgRefGlow_)    \
+    .pElemCold = (gslc_tsElemCold*)&sElem_##Cold,
+  #define GSLC_ELEM_INIT_EVENT_P(pfuncXEvent_)
+  #define GSLC_ELEM_INIT_TICK_P(pfuncXTick_)
+#else
+  #define GSLC_ELEM_DEF_COLD_P(sElem_,sImgRefNorm_,sImgRefGlow_,pfuncXEvent_,pfuncXTick_)
+  #define GSLC_ELEM_INIT_IMG_P(sElem_,sImgRefNorm_,sImgRefGlow_)    \
+    .sImgRefNorm = sImgRefNorm_, .sImgRefGlow = sImgRefGlow_,
+  #define GSLC_ELEM_INIT_EVENT_P(pfuncXEvent_)  .pfuncXEvent = pfuncXEvent_,
+  #define GSLC_ELEM_INIT_TICK_P(pfuncXTick_)    .pfuncXTick = pfuncXTick_,
+#endif // GSLC_FEATURE_ELEM_COLD
+
+/// \def gslc_ElemDefine_P(sElem_,nElemId_,nFeatures_,nType_,nX_,nY_,nW_,nH_,nGroup_,colFrame_,colFill_,colFrameGlow_,colFillGlow_,sImgRefNorm_,sImgRefGlow_,pStrBuf_,nStrBufMax_,eTxtFlags_,colTxt_,colTxtGlow_,eTxtAlign_,nTxtMarginX_,nTxtMarginY_,pTxtFont_,pXData_,pfuncXEvent_,pfuncXDraw_,pfuncXTouch_,pfuncXTick_)
+///
+/// Define a read-only element variable (located in PROGMEM if enabled)
+/// - Used by the ElemCreate*_P() macros and can be used directly at
+///   file scope to define elements for a table registered with
+///   gslc_PageAddStatic() (see gslc_ElemRefInit_P)
+/// - The initializer is written with designated initializers, so the
+///   definition doesn't depend on which optional fields the
+///   GSLC_FEATURE_* options add to gslc_tsElem
+/// - With GSLC_FEATURE_ELEM_COLD, the images and callbacks are placed
+///   in a read-only side record named after the element
+/// - Strings referenced by pStrBuf_ must be in PROGMEM if eTxtFlags_
+///   includes GSLC_TXT_MEM_PROG
+///
+/// \param[in]  sElem_:        Name of the element variable to define
+/// \param[in]  nElemId_:      Unique element ID to assign
+/// \param[in]  nFeatures_:    Element feature vector (GSLC_ELEM_FEA_*)
+/// \param[in]  nType_:        Element type
+/// \param[in]  nX_:           X coordinate of element
+/// \param[in]  nY_:           Y coordinate of element
+/// \param[in]  nW_:           Width of element
+/// \param[in]  nH_:           Height of element
+/// \param[in]  nGroup_:       Group ID (or GSLC_GROUP_ID_NONE)
+/// \param[in]  colFrame_:     Color for the frame
+/// \param[in]  colFill_:      Color for the fill
+/// \param[in]  colFrameGlow_: Color for the frame when glowing
+/// \param[in]  colFillGlow_:  Color for the fill when glowing
+/// \param[in]  sImgRefNorm_:  Image reference (or GSLC_IMGREF_INIT_NONE)
+/// \param[in]  sImgRefGlow_:  Image reference when glowing (or GSLC_IMGREF_INIT_NONE)
+/// \param[in]  pStrBuf_:      Ptr to text string (or NULL)
+/// \param[in]  nStrBufMax_:   Size of text string buffer (0 if read-only)
+/// \param[in]  eTxtFlags_:    Text flags (GSLC_TXT_*)
+/// \param[in]  colTxt_:       Color for the text
+/// \param[in]  colTxtGlow_:   Color for the text when glowing
+/// \param[in]  eTxtAlign_:    Text alignment
+/// \param[in]  nTxtMarginX_:  Text margin (X offset)
+/// \param[in]  nTxtMarginY_:  Text margin (Y offset)
+/// \param[in]  pTxtFont_:     Ptr to font resource (or NULL)
+/// \param[in]  pXData_:       Ptr to extended data structure (or NULL)
+/// \param[in]  pfuncXEvent_:  Callback function ptr for Event
+/// \param[in]  pfuncXDraw_:   Callback function ptr for Redraw
+/// \param[in]  pfuncXTouch_:  Callback function ptr for Touch
+/// \param[in]  pfuncXTick_:   Callback function ptr for Timer tick
+///
+#define gslc_ElemDefine_P(sElem_,nElemId_,nFeatures_,nType_,nX_,nY_,nW_,nH_,nGroup_,colFrame_,colFill_,colFrameGlow_,colFillGlow_,sImgRefNorm_,sImgRefGlow_,pStrBuf_,nStrBufMax_,eTxtFlags_,colTxt_,colTxtGlow_,eTxtAlign_,nTxtMarginX_,nTxtMarginY_,pTxtFont_,pXData_,pfuncXEvent_,pfuncXDraw_,pfuncXTouch_,pfuncXTick_) \
+  GSLC_ELEM_DEF_COLD_P(sElem_,sImgRefNorm_,sImgRefGlow_,pfuncXEvent_,pfuncXTick_) \
+  static const gslc_tsElem sElem_ GSLC_PMEM = {                   \
+      .nId              = nElemId_,                               \
+      .nFeatures        = nFeatures_,                             \
+      .nType            = nType_,                                 \
+      .rElem            = {nX_,nY_,nW_,nH_},                      \
+      .nGroup           = nGroup_,                                \
+      .colElemFrame     = colFrame_,                              \
+      .colElemFill      = colFill_,                               \
+      .colElemFrameGlow = colFrameGlow_,                          \
+      .colElemFillGlow  = colFillGlow_,                           \
+      GSLC_ELEM_INIT_IMG_P(sElem_,sImgRefNorm_,sImgRefGlow_)      \
+      .pElemRefParent   = NULL,                                   \
+      .pStrBuf          = pStrBuf_,                               \
+      .nStrBufMax       = nStrBufMax_,                            \
+      GSLC_ELEM_INIT_STYLE_P                                      \
+      .eTxtFlags        = eTxtFlags_,                             \
+      .colElemText      = colTxt_,                                \
+      .colElemTextGlow  = colTxtGlow_,                            \
+      .eTxtAlign        = eTxtAlign_,                             \
+      .nTxtMarginX      = nTxtMarginX_,                           \
+      .nTxtMarginY      = nTxtMarginY_,                           \
+      .pTxtFont         = pTxtFont_,                              \
+      .pXData           = pXData_,                                \
+      GSLC_ELEM_INIT_EVENT_P(pfuncXEvent_)                        \
+      .pfuncXDraw       = pfuncXDraw_,                            \
+      .pfuncXTouch      = pfuncXTouch_,                           \
+      GSLC_ELEM_INIT_TICK_P(pfuncXTick_)                          \
+      GSLC_ELEM_INIT_TXT_SIZE_P                                   \
+      GSLC_ELEM_INIT_TXT_DIFF_P                                   \
+      GSLC_ELEM_INIT_TXT_WRAP_P                                   \
+  }
 
 
 /// \def gslc_ElemCreateTxt_P(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn)
@@ -3012,21 +3805,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
   static const char str##nElemId[] PROGMEM = strTxt;              \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)str##nElemId,                                        \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_PROG | GSLC_TXT_ALLOC_EXT),  \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3035,8 +3827,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3044,21 +3835,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 #define gslc_ElemCreateTxt_P_R(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)strTxt,                                              \
       strLength,                                                  \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3067,29 +3857,27 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateTxt_P_R_ext(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colTxtGlow,colFrame,colFill,nAlignTxt,nMarginX,nMarginY,bFrameEn,bFillEn,bClickEn,bGlowEn,pfuncXEvent,pfuncXDraw,pfuncXTouch,pfuncXTick) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0) | (bClickEn?GSLC_ELEM_FEA_CLICK_EN:0) | (bGlowEn?GSLC_ELEM_FEA_GLOW_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)strTxt,                                              \
       strLength,                                                  \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
-      colTxt,                                                     \
-      colTxtGlow,                                                 \
+      (colTxt),                                                   \
+      (colTxtGlow),                                               \
       nAlignTxt,                                                  \
       nMarginX,                                                   \
       nMarginY,                                                   \
@@ -3098,8 +3886,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       pfuncXEvent,                                                \
       pfuncXDraw,                                                 \
       pfuncXTouch,                                                \
-      pfuncXTick,                                                 \
-  };                                                              \
+      pfuncXTick);                                                \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3108,21 +3895,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 #define gslc_ElemCreateBox_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_BOX,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       GSLC_TXT_DEFAULT,                                           \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -3131,28 +3917,26 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       pfuncXDraw,                                                 \
       NULL,                                                       \
-      pfuncXTick,                                                 \
-  };                                                              \
+      pfuncXTick);                                                \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateLine_P(pGui,nElemId,nPage,nX0,nY0,nX1,nY1,colFill) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID;  \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_LINE,                                             \
-      (gslc_tsRect){nX0,nY0,nX1-nX0+1,nY1-nY0+1},                 \
+      nX0,nY0,nX1-nX0+1,nY1-nY0+1,                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFill,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,              \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFill),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),      \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       GSLC_TXT_DEFAULT,                                           \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -3161,8 +3945,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3171,21 +3954,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_BTN,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,colFrameGlow,colFillGlow,                  \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(colFrameGlow),(colFillGlow),          \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)str##nElemId,                                        \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_PROG | GSLC_TXT_ALLOC_EXT),  \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3194,8 +3976,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       callFunc,                                                   \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3203,21 +3984,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_BTN,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,colFrameGlow,colFillGlow,                  \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(colFrameGlow),(colFillGlow),          \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)strTxt,                                              \
-      strLength,                                                          \
+      strLength,                                                  \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3226,8 +4006,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       callFunc,                                                   \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3239,21 +4018,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
   static const char str##nElemId[] = strTxt;                      \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)str##nElemId,                                        \
       0,                                                          \
-      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),  \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3262,8 +4040,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3271,21 +4048,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 #define gslc_ElemCreateTxt_P_R(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colFrame,colFill,nAlignTxt,bFrameEn,bFillEn) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)strTxt,                                              \
       strLength,                                                  \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3294,29 +4070,27 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateTxt_P_R_ext(pGui,nElemId,nPage,nX,nY,nW,nH,strTxt,strLength,pFont,colTxt,colTxtGlow,colFrame,colFill,nAlignTxt,nMarginX,nMarginY,bFrameEn,bFillEn,bClickEn,bGlowEn,pfuncXEvent,pfuncXDraw,pfuncXTouch,pfuncXTick) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0) | (bClickEn?GSLC_ELEM_FEA_CLICK_EN:0) | (bGlowEn?GSLC_ELEM_FEA_GLOW_EN:0); \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_TXT,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)strTxt,                                              \
       strLength,                                                  \
       (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
-      colTxt,                                                     \
-      colTxtGlow,                                                 \
+      (colTxt),                                                   \
+      (colTxtGlow),                                               \
       nAlignTxt,                                                  \
       nMarginX,                                                   \
       nMarginY,                                                   \
@@ -3325,8 +4099,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       pfuncXEvent,                                                \
       pfuncXDraw,                                                 \
       pfuncXTouch,                                                \
-      pfuncXTick,                                                 \
-  };                                                              \
+      pfuncXTick);                                                \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3334,21 +4107,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 #define gslc_ElemCreateBox_P(pGui,nElemId,nPage,nX,nY,nW,nH,colFrame,colFill,bFrameEn,bFillEn,pfuncXDraw,pfuncXTick) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_BOX,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,             \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),     \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       GSLC_TXT_DEFAULT,                                           \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -3357,28 +4129,26 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       pfuncXDraw,                                                 \
       NULL,                                                       \
-      pfuncXTick,                                                 \
-  };                                                              \
+      pfuncXTick);                                                \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
 #define gslc_ElemCreateLine_P(pGui,nElemId,nPage,nX0,nY0,nX1,nY1,colFill) \
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID;  \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_LINE,                                             \
-      (gslc_tsRect){nX0,nY0,nX1-nX0+1,nY1-nY0+1},                 \
+      nX0,nY0,nX1-nX0+1,nY1-nY0+1,                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFill,colFill,GSLC_COL_BLACK,GSLC_COL_BLACK,              \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFill),(colFill),(GSLC_COL_BLACK),(GSLC_COL_BLACK),      \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       GSLC_TXT_DEFAULT,                                           \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -3387,8 +4157,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3397,21 +4166,20 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
   static const uint16_t nFeatures##nElemId = GSLC_ELEM_FEA_VALID | \
     GSLC_ELEM_FEA_CLICK_EN | GSLC_ELEM_FEA_GLOW_EN |              \
     (bFrameEn?GSLC_ELEM_FEA_FRAME_EN:0) | (bFillEn?GSLC_ELEM_FEA_FILL_EN:0); \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPE_BTN,                                              \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame,colFill,colFrameGlow,colFillGlow,                  \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame),(colFill),(colFrameGlow),(colFillGlow),          \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       (char*)str##nElemId,                                        \
       0,                                                          \
-      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),  \
-      colTxt,                                                     \
-      colTxt,                                                     \
+      (gslc_teTxtFlags)(GSLC_TXT_MEM_RAM | GSLC_TXT_ALLOC_EXT),   \
+      (colTxt),                                                   \
+      (colTxt),                                                   \
       nAlignTxt,                                                  \
       0,                                                          \
       0,                                                          \
@@ -3420,8 +4188,7 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
       NULL,                                                       \
       NULL,                                                       \
       callFunc,                                                   \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -3429,6 +4196,26 @@ void gslc_FocusSetToTrackedElem(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
 #endif // GSLC_USE_PROGMEM
 
 
+/// \def gslc_ElemRefInit_P(sElem)
+///
+/// Initializer for an entry in a compile-time element reference table
+/// - The table is declared as static const gslc_tsElemRef with GSLC_PMEM
+///   and is registered with gslc_PageAddStatic()
+/// - The element must be defined with gslc_ElemDefine_P()
+///
+/// \param[in]  sElem:        Element definition
+///
+#if (GSLC_USE_PROGMEM)
+  #define gslc_ElemRefInit_P(sElem)                                 \
+    { (gslc_tsElem*)&(sElem),                                       \
+      (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL) }
+#else
+  #define gslc_ElemRefInit_P(sElem)                                 \
+    { (gslc_tsElem*)&(sElem),                                       \
+      (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL) }
+#endif // GSLC_USE_PROGMEM
+
+
 
 // ========================================================================
 /// @}
@@ -3752,6 +4539,80 @@ gslc_tsPage* gslc_PageFindById(gslc_tsGui* pGui,int16_t nPageId);
 /// \internal
 void gslc_PageRedrawCalc(gslc_tsGui* pGui);
 
+///
+/// Record an element reference in the list of elements needing redraw
+/// - If the list is full, the list is marked as overflowed and
+///   the next redraw will scan all elements instead
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return none
+///
+/// \internal
+void gslc_DirtyElemAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Locate an element reference within the pages of the page stack
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[out] pnStackPage: Position in the page stack
+/// \param[out] pnElemInd:   Index of the element reference in the page's collection
+///
+/// \return true if the element reference belongs to a page in the stack, false otherwise
+///
+/// \internal
+bool gslc_DirtyElemFind(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint8_t* pnStackPage,uint16_t* pnElemInd);
+
+///
+/// Update the list of elements needing redraw after a page redraw
+/// - Entries that have since been redrawn (or that no longer belong
+///   to a page in the stack) are dropped
+/// - If the list overflowed, it is rebuilt from the pages in the stack
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_DirtyElemUpdate(gslc_tsGui* pGui);
+
+///
+/// Schedule the tick callback for an element
+/// - If the element is already scheduled, its period is updated
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  nPeriod:     Minimum time between ticks (ms), or 0 for every update
+///
+/// \return true if success, false if the tick schedule is full
+///
+/// \internal
+bool gslc_TickAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,uint16_t nPeriod);
+
+///
+/// Remove an element from the tick schedule
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+///
+/// \return none
+///
+/// \internal
+void gslc_TickRemove(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
+
+///
+/// Issue tick events to the elements whose tick is due
+/// - Each scheduled element is ticked at most once per call
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+/// \internal
+void gslc_TickDispatch(gslc_tsGui* pGui);
+
 
 ///
 /// Create an event structure
@@ -3885,6 +4746,21 @@ gslc_tsElemRef* gslc_CollectFindElemById(gslc_tsGui* pGui,gslc_tsCollect* pColle
 ///
 gslc_tsElemRef* gslc_CollectFindElemFromCoord(gslc_tsGui* pGui,gslc_tsCollect* pCollect,int16_t nX, int16_t nY, int16_t* pnElemInd);
 
+#if (GSLC_FEATURE_HIT_GRID)
+///
+/// Build the hit-test index for a collection
+/// - Called automatically by gslc_CollectFindElemFromCoord()
+///   when the index is out of date
+///
+/// \param[in]  pGui:         Pointer to GUI
+/// \param[in]  pCollect:     Pointer to the collection
+///
+/// \return none
+///
+/// \internal
+void gslc_CollectHitGridBuild(gslc_tsGui* pGui,gslc_tsCollect* pCollect);
+#endif // GSLC_FEATURE_HIT_GRID
+
 
 /// Allocate the next available Element ID in a collection
 ///
@@ -4125,6 +5001,59 @@ void gslc_ResetFont(gslc_tsFont* pFont);
 ///
 void gslc_ResetElem(gslc_tsElem* pElem);
 
+///
+/// Fetch the normal or glowing image reference of an element
+/// - With GSLC_FEATURE_ELEM_COLD, the image references are held
+///   in a side record that is only allocated on request
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  bGlow:       Fetch the glowing image (else the normal image)
+/// \param[in]  bAlloc:      Allocate the side record if it doesn't exist
+///
+/// \return Pointer to the image reference or NULL if the element
+///         has no side record (and bAlloc is false) or none is available
+///
+gslc_tsImgRef* gslc_ElemGetImgRef(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow,bool bAlloc);
+
+///
+/// Fetch the frame color of an element
+/// - Resolves the element's shared style (GSLC_FEATURE_STYLE) in
+///   the same way as gslc_ElemCalcRectState(). Extended elements
+///   should use this rather than reading the element colors directly.
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  bGlow:       Fetch the glowing color (else the normal color)
+///
+/// \return Frame color
+///
+gslc_tsColor gslc_ElemGetColFrame(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow);
+
+///
+/// Fetch the fill color of an element
+/// - Resolves the element's shared style (see gslc_ElemGetColFrame)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  bGlow:       Fetch the glowing color (else the normal color)
+///
+/// \return Fill color
+///
+gslc_tsColor gslc_ElemGetColFill(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow);
+
+///
+/// Fetch the text color of an element
+/// - Resolves the element's shared style (see gslc_ElemGetColFrame)
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElem:       Pointer to Element
+/// \param[in]  bGlow:       Fetch the glowing color (else the normal color)
+///
+/// \return Text color
+///
+gslc_tsColor gslc_ElemGetColTxt(gslc_tsGui* pGui,gslc_tsElem* pElem,bool bGlow);
+
 
 /// @}
 /// End of Internal Functions
@@ -159,6 +159,7 @@ extern "C" {
   //#include "../configs/rpi-sdl1-default-tslib.h"
   //#include "../configs/rpi-sdl1-default-sdl.h"
   //#include "../configs/linux-sdl1-default-mouse.h"
+  //#include "../configs/linux-mem-default-inject.h"
 
 #endif // USER_CONFIG_LOADED
 
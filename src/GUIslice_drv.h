@@ -53,6 +53,8 @@ extern "C" {
   #include "GUIslice_drv_m5stack.h"
 #elif defined(DRV_DISP_UTFT)
   #include "GUIslice_drv_utft.h"
+#elif defined(DRV_DISP_MEM)
+  #include "GUIslice_drv_mem.h"
 #else
   #error No driver specified (DRV_DISP_*). Ensure a config is selected in GUIslice_config.h
 #endif
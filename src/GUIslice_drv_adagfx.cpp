@@ -893,20 +893,26 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
 
 bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
-  (void)pGui; // Unused
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
 
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
-  (void)pGui; // Unused
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,true,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
@@ -143,6 +143,9 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_SAVE_RECT              0 ///< Support gslc_DrvSaveRect() and gslc_DrvRestoreRect()
+#define DRV_HAS_FLIP_RECTS             0 ///< Support gslc_DrvPageFlipRects()
+#define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
 
 #define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
 
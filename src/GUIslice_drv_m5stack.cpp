@@ -184,7 +184,11 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
@@ -193,7 +197,11 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,true,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
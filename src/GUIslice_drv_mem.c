@@ -0,0 +1,1201 @@
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_mem.c
+
+// Compiler guard for requested driver
+#include "GUIslice_config.h" // Sets DRV_DISP_*
+#if defined(DRV_DISP_MEM)
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// =======================================================================
+
+
+// GUIslice library
+#include "GUIslice_drv_mem.h"
+
+#include <stdio.h>
+#include <stdlib.h>     // For malloc(), free()
+#include <string.h>     // For memset(), memcpy(), memmove()
+
+// Define driver names
+const char* m_acDrvDisp = "MEM";
+
+#if defined(DRV_TOUCH_MEM)
+  const char* m_acDrvTouch = "MEM";
+#else
+  const char* m_acDrvTouch = "NONE";
+#endif
+
+// ------------------------------------------------------------------------
+// Built-in font
+// ------------------------------------------------------------------------
+
+// Dimensions of a character cell in the built-in font
+#define DRV_MEM_FONT_W      6   // Includes 1 column of spacing
+#define DRV_MEM_FONT_H      8
+#define DRV_MEM_FONT_FIRST  0x20
+#define DRV_MEM_FONT_LAST   0x7E
+
+// Classic 5x7 font covering printable ASCII (0x20..0x7E)
+// - Each character is 5 columns, LSB at the top row
+static const uint8_t m_acDrvMemFont[(DRV_MEM_FONT_LAST-DRV_MEM_FONT_FIRST+1)*5] = {
+  0x00,0x00,0x00,0x00,0x00, 0x00,0x00,0x5F,0x00,0x00, 0x00,0x07,0x00,0x07,0x00, // ' ' ! "
+  0x14,0x7F,0x14,0x7F,0x14, 0x24,0x2A,0x7F,0x2A,0x12, 0x23,0x13,0x08,0x64,0x62, // # $ %
+  0x36,0x49,0x56,0x20,0x50, 0x00,0x08,0x07,0x03,0x00, 0x00,0x1C,0x22,0x41,0x00, // & ' (
+  0x00,0x41,0x22,0x1C,0x00, 0x2A,0x1C,0x7F,0x1C,0x2A, 0x08,0x08,0x3E,0x08,0x08, // ) * +
+  0x00,0x80,0x70,0x30,0x00, 0x08,0x08,0x08,0x08,0x08, 0x00,0x00,0x60,0x60,0x00, // , - .
+  0x20,0x10,0x08,0x04,0x02, 0x3E,0x51,0x49,0x45,0x3E, 0x00,0x42,0x7F,0x40,0x00, // / 0 1
+  0x72,0x49,0x49,0x49,0x46, 0x21,0x41,0x49,0x4D,0x33, 0x18,0x14,0x12,0x7F,0x10, // 2 3 4
+  0x27,0x45,0x45,0x45,0x39, 0x3C,0x4A,0x49,0x49,0x31, 0x41,0x21,0x11,0x09,0x07, // 5 6 7
+  0x36,0x49,0x49,0x49,0x36, 0x46,0x49,0x49,0x29,0x1E, 0x00,0x00,0x14,0x00,0x00, // 8 9 :
+  0x00,0x40,0x34,0x00,0x00, 0x00,0x08,0x14,0x22,0x41, 0x14,0x14,0x14,0x14,0x14, // ; < =
+  0x00,0x41,0x22,0x14,0x08, 0x02,0x01,0x59,0x09,0x06, 0x3E,0x41,0x5D,0x59,0x4E, // > ? @
+  0x7C,0x12,0x11,0x12,0x7C, 0x7F,0x49,0x49,0x49,0x36, 0x3E,0x41,0x41,0x41,0x22, // A B C
+  0x7F,0x41,0x41,0x41,0x3E, 0x7F,0x49,0x49,0x49,0x41, 0x7F,0x09,0x09,0x09,0x01, // D E F
+  0x3E,0x41,0x41,0x51,0x73, 0x7F,0x08,0x08,0x08,0x7F, 0x00,0x41,0x7F,0x41,0x00, // G H I
+  0x20,0x40,0x41,0x3F,0x01, 0x7F,0x08,0x14,0x22,0x41, 0x7F,0x40,0x40,0x40,0x40, // J K L
+  0x7F,0x02,0x1C,0x02,0x7F, 0x7F,0x04,0x08,0x10,0x7F, 0x3E,0x41,0x41,0x41,0x3E, // M N O
+  0x7F,0x09,0x09,0x09,0x06, 0x3E,0x41,0x51,0x21,0x5E, 0x7F,0x09,0x19,0x29,0x46, // P Q R
+  0x26,0x49,0x49,0x49,0x32, 0x03,0x01,0x7F,0x01,0x03, 0x3F,0x40,0x40,0x40,0x3F, // S T U
+  0x1F,0x20,0x40,0x20,0x1F, 0x3F,0x40,0x38,0x40,0x3F, 0x63,0x14,0x08,0x14,0x63, // V W X
+  0x03,0x04,0x78,0x04,0x03, 0x61,0x59,0x49,0x4D,0x43, 0x00,0x7F,0x41,0x41,0x41, // Y Z [
+  0x02,0x04,0x08,0x10,0x20, 0x00,0x41,0x41,0x41,0x7F, 0x04,0x02,0x01,0x02,0x04, // \ ] ^
+  0x40,0x40,0x40,0x40,0x40, 0x00,0x03,0x07,0x08,0x00, 0x20,0x54,0x54,0x78,0x40, // _ ` a
+  0x7F,0x28,0x44,0x44,0x38, 0x38,0x44,0x44,0x44,0x28, 0x38,0x44,0x44,0x28,0x7F, // b c d
+  0x38,0x54,0x54,0x54,0x18, 0x00,0x08,0x7E,0x09,0x02, 0x18,0xA4,0xA4,0x9C,0x78, // e f g
+  0x7F,0x08,0x04,0x04,0x78, 0x00,0x44,0x7D,0x40,0x00, 0x20,0x40,0x40,0x3D,0x00, // h i j
+  0x7F,0x10,0x28,0x44,0x00, 0x00,0x41,0x7F,0x40,0x00, 0x7C,0x04,0x78,0x04,0x78, // k l m
+  0x7C,0x08,0x04,0x04,0x78, 0x38,0x44,0x44,0x44,0x38, 0xFC,0x18,0x24,0x24,0x18, // n o p
+  0x18,0x24,0x24,0x18,0xFC, 0x7C,0x08,0x04,0x04,0x08, 0x48,0x54,0x54,0x54,0x24, // q r s
+  0x04,0x04,0x3F,0x44,0x24, 0x3C,0x40,0x40,0x20,0x7C, 0x1C,0x20,0x40,0x20,0x1C, // t u v
+  0x3C,0x40,0x30,0x40,0x3C, 0x44,0x28,0x10,0x28,0x44, 0x4C,0x90,0x90,0x90,0x7C, // w x y
+  0x44,0x64,0x54,0x4C,0x44, 0x00,0x08,0x36,0x41,0x00, 0x00,0x00,0x77,0x00,0x00, // z { |
+  0x00,0x41,0x36,0x08,0x00, 0x02,0x01,0x02,0x04,0x02,                           // } ~
+};
+
+
+// ------------------------------------------------------------------------
+// Local helpers
+// ------------------------------------------------------------------------
+
+// Allocate the framebuffer for the current rotation and
+// reset the associated GUI dimensions
+static bool gslc_DrvMemAlloc(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  if (pDriver->pFrameBuf) {
+    free(pDriver->pFrameBuf);
+    pDriver->pFrameBuf = NULL;
+  }
+
+  pGui->nDisp0W = DRV_MEM_WIDTH;
+  pGui->nDisp0H = DRV_MEM_HEIGHT;
+  if ((pGui->nRotation == 0) || (pGui->nRotation == 2)) {
+    pGui->nDispW = DRV_MEM_WIDTH;
+    pGui->nDispH = DRV_MEM_HEIGHT;
+  } else {
+    pGui->nDispW = DRV_MEM_HEIGHT;
+    pGui->nDispH = DRV_MEM_WIDTH;
+  }
+  pGui->nDispDepth = DRV_MEM_BPP;
+
+  pDriver->nFrameW     = pGui->nDispW;
+  pDriver->nFrameH     = pGui->nDispH;
+  pDriver->nFramePitch = (uint32_t)pDriver->nFrameW * DRV_MEM_PIXEL_BYTES;
+  pDriver->pFrameBuf   = (uint8_t*)calloc(pDriver->nFrameH,pDriver->nFramePitch);
+  if (pDriver->pFrameBuf == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit() failed to allocate %ux%u framebuffer\n",
+      pDriver->nFrameW,pDriver->nFrameH);
+    return false;
+  }
+
+  pDriver->rClipRect = (gslc_tsRect){0,0,pDriver->nFrameW,pDriver->nFrameH};
+  return true;
+}
+
+// Determine the scale factor to apply to the built-in font
+static uint8_t gslc_DrvMemFontScale(gslc_tsFont* pFont)
+{
+  uint16_t nScale;
+  if (pFont->eFontRefType == GSLC_FONTREF_FNAME) {
+    // Font size is a pixel height (as in SDL_ttf)
+    nScale = pFont->nSize / DRV_MEM_FONT_H;
+  } else {
+    // Font size is a scale factor (as in Adafruit-GFX)
+    nScale = pFont->nSize;
+  }
+  return (nScale < 1)? 1 : (uint8_t)nScale;
+}
+
+// Fetch the next character from a string and advance the pointer
+// - UTF-8 multi-byte sequences are consumed as a single character
+//   and rendered as '?' since the built-in font only covers ASCII
+static char gslc_DrvMemNextChar(const char** ppStr,gslc_teTxtFlags eTxtFlags)
+{
+  const uint8_t* pStr = (const uint8_t*)(*ppStr);
+  uint8_t        nCh;
+
+  // NOTE: GSLC_TXT_MEM_PROG strings are directly addressable in LINUX
+  (void)eTxtFlags;
+  nCh = *(pStr++);
+
+  if (((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) && (nCh >= 0x80)) {
+    // Skip continuation bytes
+    while ((*pStr & 0xC0) == 0x80) {
+      pStr++;
+    }
+    nCh = '?';
+  }
+  *ppStr = (const char*)pStr;
+  return (char)nCh;
+}
+
+// Copy a run of pixels (with optional mask) into the framebuffer
+// - The run must already be clipped
+static void gslc_DrvMemBlitRow(gslc_tsDriver* pDriver,int16_t nX,int16_t nY,uint16_t nW,
+  const uint8_t* pSrc,const uint8_t* pMask)
+{
+  uint8_t* pDst = pDriver->pFrameBuf + (uint32_t)nY*pDriver->nFramePitch + (uint32_t)nX*DRV_MEM_PIXEL_BYTES;
+  uint16_t nInd;
+  if (pMask == NULL) {
+    memcpy(pDst,pSrc,(size_t)nW*DRV_MEM_PIXEL_BYTES);
+    return;
+  }
+  for (nInd=0;nInd<nW;nInd++) {
+    if (pMask[nInd]) {
+      memcpy(pDst,pSrc,DRV_MEM_PIXEL_BYTES);
+    }
+    pDst += DRV_MEM_PIXEL_BYTES;
+    pSrc += DRV_MEM_PIXEL_BYTES;
+  }
+}
+
+// Fill a rect after clipping it to the current clip region
+// - Shared by the drawing primitives so that composite shapes
+//   are only counted once in nDrawCnt
+static bool gslc_DrvMemFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        anPixel[DRV_MEM_PIXEL_BYTES];
+  int16_t        nY;
+
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rRect)) { return true; }
+
+  gslc_DrvMemAdaptColorRaw(nCol,anPixel);
+  gslc_DrvMemFillSpan(pGui,rRect.x,rRect.y,rRect.w,anPixel);
+
+  // Replicate the first row for the remainder of the rect
+  uint8_t* pRow0 = pDriver->pFrameBuf + (uint32_t)rRect.y*pDriver->nFramePitch + (uint32_t)rRect.x*DRV_MEM_PIXEL_BYTES;
+  size_t   nRowBytes = (size_t)rRect.w*DRV_MEM_PIXEL_BYTES;
+  for (nY=1;nY<rRect.h;nY++) {
+    memcpy(pRow0 + (uint32_t)nY*pDriver->nFramePitch,pRow0,nRowBytes);
+  }
+  return true;
+}
+
+// Draw a pre-loaded image after clipping it to the current clip region
+static bool gslc_DrvMemDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  // Images are always pre-loaded before calling DrvDrawImage(), so
+  // we just need to confirm that the raw image data is defined.
+  gslc_tsDrvMemImage* pImg = (gslc_tsDrvMemImage*)(sImgRef.pvImgRaw);
+  if (pImg == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL pvImgRaw\n","");
+    return false;
+  }
+
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect    rDst    = (gslc_tsRect){nDstX,nDstY,pImg->nW,pImg->nH};
+  int16_t        nRow;
+
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rDst)) { return true; }
+
+  for (nRow=0;nRow<rDst.h;nRow++) {
+    uint32_t nSrcInd = (uint32_t)(rDst.y-nDstY+nRow)*pImg->nW + (rDst.x-nDstX);
+    gslc_DrvMemBlitRow(pDriver,rDst.x,rDst.y+nRow,rDst.w,
+      pImg->pPixels + nSrcInd*DRV_MEM_PIXEL_BYTES,
+      (pImg->pMask)? pImg->pMask + nSrcInd : NULL);
+  }
+  return true;
+}
+
+// Allocate an empty image in framebuffer format
+static gslc_tsDrvMemImage* gslc_DrvMemImageCreate(uint16_t nW,uint16_t nH,bool bMask)
+{
+  gslc_tsDrvMemImage* pImg = (gslc_tsDrvMemImage*)malloc(sizeof(gslc_tsDrvMemImage));
+  if (pImg == NULL) {
+    return NULL;
+  }
+  pImg->nW      = nW;
+  pImg->nH      = nH;
+  pImg->pPixels = (uint8_t*)calloc((size_t)nW*nH,DRV_MEM_PIXEL_BYTES);
+  pImg->pMask   = (bMask)? (uint8_t*)calloc((size_t)nW*nH,1) : NULL;
+  if ((pImg->pPixels == NULL) || (bMask && (pImg->pMask == NULL))) {
+    gslc_DrvImageDestruct(pImg);
+    return NULL;
+  }
+  return pImg;
+}
+
+// Read a little-endian value from a BMP header
+static uint32_t gslc_DrvMemReadLE(const uint8_t* pBuf,uint8_t nBytes)
+{
+  uint32_t nVal = 0;
+  while (nBytes--) {
+    nVal = (nVal << 8) | pBuf[nBytes];
+  }
+  return nVal;
+}
+
+// Load an uncompressed 24-bit or 32-bit BMP file
+static gslc_tsDrvMemImage* gslc_DrvMemLoadBmpFile(gslc_tsGui* pGui,const char* pStrFname)
+{
+  FILE*               pFile = NULL;
+  uint8_t             anHdr[54];
+  gslc_tsDrvMemImage* pImg = NULL;
+  uint8_t*            pRow = NULL;
+
+  pFile = fopen(pStrFname,"rb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) failed to open\n",pStrFname);
+    return NULL;
+  }
+  if ((fread(anHdr,1,sizeof(anHdr),pFile) != sizeof(anHdr)) || (anHdr[0] != 'B') || (anHdr[1] != 'M')) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) invalid header\n",pStrFname);
+    fclose(pFile);
+    return NULL;
+  }
+
+  uint32_t  nOffset   = gslc_DrvMemReadLE(&anHdr[10],4);
+  int32_t   nW        = (int32_t)gslc_DrvMemReadLE(&anHdr[18],4);
+  int32_t   nH        = (int32_t)gslc_DrvMemReadLE(&anHdr[22],4);
+  uint16_t  nBpp      = (uint16_t)gslc_DrvMemReadLE(&anHdr[28],2);
+  uint32_t  nCompress = gslc_DrvMemReadLE(&anHdr[30],4);
+  bool      bFlip     = true;   // BMP rows are normally stored bottom-up
+
+  if (nH < 0) {
+    nH = -nH;
+    bFlip = false;
+  }
+  if (((nBpp != 24) && (nBpp != 32)) || ((nCompress != 0) && (nCompress != 3)) ||
+      (nW <= 0) || (nH <= 0) || (nW > 0xFFFF) || (nH > 0xFFFF)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) unsupported format (%u bpp)\n",pStrFname,nBpp);
+    fclose(pFile);
+    return NULL;
+  }
+
+  uint8_t   nSrcBytes = nBpp/8;
+  uint32_t  nRowSize  = ((uint32_t)nW*nSrcBytes + 3) & ~3u;
+  int32_t   nRow,nCol;
+  uint8_t*  pPixel;
+  bool      bMask     = GSLC_BMP_TRANS_EN;
+
+  pImg = gslc_DrvMemImageCreate((uint16_t)nW,(uint16_t)nH,bMask);
+  pRow = (uint8_t*)malloc(nRowSize);
+  if ((pImg == NULL) || (pRow == NULL) || (fseek(pFile,nOffset,SEEK_SET) != 0)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) failed to load\n",pStrFname);
+    gslc_DrvImageDestruct(pImg);
+    free(pRow);
+    fclose(pFile);
+    return NULL;
+  }
+
+  for (nRow=0;nRow<nH;nRow++) {
+    if (fread(pRow,1,nRowSize,pFile) != nRowSize) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvLoadBmpFile(%s) truncated\n",pStrFname);
+      gslc_DrvImageDestruct(pImg);
+      free(pRow);
+      fclose(pFile);
+      return NULL;
+    }
+    int32_t nDstRow = (bFlip)? (nH-1-nRow) : nRow;
+    for (nCol=0;nCol<nW;nCol++) {
+      // BMP pixels are stored as B,G,R(,X)
+      gslc_tsColor nCol888 = (gslc_tsColor){ pRow[nCol*nSrcBytes+2],pRow[nCol*nSrcBytes+1],pRow[nCol*nSrcBytes+0] };
+      uint32_t     nPixInd = (uint32_t)nDstRow*nW + nCol;
+      pPixel = pImg->pPixels + nPixInd*DRV_MEM_PIXEL_BYTES;
+      gslc_DrvMemAdaptColorRaw(nCol888,pPixel);
+      if (bMask) {
+        pImg->pMask[nPixInd] = ((nCol888.r == pGui->sTransCol.r) && (nCol888.g == pGui->sTransCol.g) &&
+          (nCol888.b == pGui->sTransCol.b))? 0 : 1;
+      }
+    }
+  }
+
+  free(pRow);
+  fclose(pFile);
+  return pImg;
+}
+
+// Load an in-memory image (BMP24 as RGB565 words or RAW1 monochrome)
+// - Program memory is directly addressable in LINUX, so RAM and
+//   PROGMEM images are handled identically
+static gslc_tsDrvMemImage* gslc_DrvMemLoadBmpMem(gslc_tsGui* pGui,const unsigned char* pBitmap,
+  gslc_teImgRefFlags eFmt)
+{
+  gslc_tsDrvMemImage* pImg = NULL;
+  uint16_t            nW,nH;
+  uint16_t            nRow,nCol;
+  uint32_t            nPixInd;
+
+  if (pBitmap == NULL) {
+    return NULL;
+  }
+
+  if (eFmt == GSLC_IMGREF_FMT_BMP24) {
+    // Header: height, width followed by RGB565 pixels
+    const uint16_t* pImage = (const uint16_t*)pBitmap;
+    nH = *(pImage++);
+    nW = *(pImage++);
+    bool bMask = GSLC_BMP_TRANS_EN;
+    uint16_t nTransRaw = ((pGui->sTransCol.r & 0xF8) << 8) | ((pGui->sTransCol.g & 0xFC) << 3) | (pGui->sTransCol.b >> 3);
+
+    pImg = gslc_DrvMemImageCreate(nW,nH,bMask);
+    if (pImg == NULL) {
+      return NULL;
+    }
+    for (nPixInd=0;nPixInd<(uint32_t)nW*nH;nPixInd++) {
+      uint16_t nColRaw = *(pImage++);
+      gslc_tsColor nCol888;
+      nCol888.r = (uint8_t)((nColRaw >> 8) & 0xF8);
+      nCol888.g = (uint8_t)((nColRaw >> 3) & 0xFC);
+      nCol888.b = (uint8_t)((nColRaw << 3) & 0xF8);
+      gslc_DrvMemAdaptColorRaw(nCol888,pImg->pPixels + nPixInd*DRV_MEM_PIXEL_BYTES);
+      if (bMask) {
+        pImg->pMask[nPixInd] = (nColRaw == nTransRaw)? 0 : 1;
+      }
+    }
+    return pImg;
+
+  } else if (eFmt == GSLC_IMGREF_FMT_RAW1) {
+    // Header: width, height (big endian) and RGB color followed by bits
+    const unsigned char* pBmap = pBitmap;
+    gslc_tsColor nColFg;
+    nW  = *(pBmap++) << 8;
+    nW |= *(pBmap++) << 0;
+    nH  = *(pBmap++) << 8;
+    nH |= *(pBmap++) << 0;
+    nColFg.r = *(pBmap++);
+    nColFg.g = *(pBmap++);
+    nColFg.b = *(pBmap++);
+
+    uint16_t nByteWidth = (nW + 7) / 8;
+    uint8_t  anPixel[DRV_MEM_PIXEL_BYTES];
+    gslc_DrvMemAdaptColorRaw(nColFg,anPixel);
+
+    // Only the set bits are drawn, so a mask is always required
+    pImg = gslc_DrvMemImageCreate(nW,nH,true);
+    if (pImg == NULL) {
+      return NULL;
+    }
+    for (nRow=0;nRow<nH;nRow++) {
+      for (nCol=0;nCol<nW;nCol++) {
+        uint32_t nByteInd = (uint32_t)nRow*nByteWidth + nCol/8;
+        uint8_t  nByte = pBmap[nByteInd];
+        if (nByte & (0x80 >> (nCol & 7))) {
+          nPixInd = (uint32_t)nRow*nW + nCol;
+          memcpy(pImg->pPixels + nPixInd*DRV_MEM_PIXEL_BYTES,anPixel,DRV_MEM_PIXEL_BYTES);
+          pImg->pMask[nPixInd] = 1;
+        }
+      }
+    }
+    return pImg;
+  }
+
+  GSLC_DEBUG2_PRINT("ERROR: DrvLoadImage() unsupported in-memory format (0x%X)\n",eFmt);
+  return NULL;
+}
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// =======================================================================
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+bool gslc_DrvInit(gslc_tsGui* pGui)
+{
+  // Primary surface definitions
+  pGui->sImgRefBkgnd = gslc_ResetImage();
+
+  if (pGui->pvDriver == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInit(%s) called with NULL driver\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  pDriver->pFrameBuf  = NULL;
+  pDriver->nFrameCnt  = 0;
+  pDriver->nFlipPixelCnt = 0;
+  pDriver->nDrawCnt   = 0;
+  pDriver->nColBkgnd  = GSLC_COL_BLACK;
+  #if defined(DRV_TOUCH_MEM)
+  pDriver->nTouchQueueHead = 0;
+  pDriver->nTouchQueueCnt  = 0;
+  #endif
+
+  // The framebuffer retains its contents between frames
+  // so partial redraws are always possible
+  pGui->bRedrawPartialEn = true;
+
+  // Assign default orientation
+  pGui->nRotation = GSLC_ROTATE;
+
+  if (!gslc_DrvMemAlloc(pGui)) {
+    return false;
+  }
+
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: Video mode: %u x %u x %u bit/pixel\n",
+          pGui->nDispW,pGui->nDispH,pGui->nDispDepth);
+  #endif
+
+  return true;
+}
+
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui)
+{
+  return (pGui->pvDriver);
+}
+
+void gslc_DrvDestruct(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->pFrameBuf) {
+    free(pDriver->pFrameBuf);
+    pDriver->pFrameBuf = NULL;
+  }
+}
+
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui)
+{
+  return m_acDrvDisp;
+}
+
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui)
+{
+  return m_acDrvTouch;
+}
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  if (sImgRef.eImgFlags == GSLC_IMGREF_NONE) {
+    return NULL;
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_SD) {
+    // Load image from SD card
+    // - Not supported in LINUX
+    return NULL;
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_RAM) {
+    // Load image from RAM
+    return (void*)gslc_DrvMemLoadBmpMem(pGui,sImgRef.pImgBuf,
+      (gslc_teImgRefFlags)(sImgRef.eImgFlags & GSLC_IMGREF_FMT));
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_PROG) {
+    // Load image from FLASH
+    return (void*)gslc_DrvMemLoadBmpMem(pGui,sImgRef.pImgBuf,
+      (gslc_teImgRefFlags)(sImgRef.eImgFlags & GSLC_IMGREF_FMT));
+  } else if ((sImgRef.eImgFlags & GSLC_IMGREF_SRC) == GSLC_IMGREF_SRC_FILE) {
+    // Load image from file system
+    return (void*)gslc_DrvMemLoadBmpFile(pGui,sImgRef.pFname);
+  } // eImgFlags
+
+  // If reached here, it is an error
+  return NULL;
+}
+
+
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef)
+{
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  pGui->sImgRefBkgnd = sImgRef;
+  pGui->sImgRefBkgnd.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (pGui->sImgRefBkgnd.pvImgRaw == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetBkgndImage(%s) failed\n","");
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+    return false;
+  }
+
+  return true;
+}
+
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Dispose of previous background
+  if (pGui->sImgRefBkgnd.eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pGui->sImgRefBkgnd.pvImgRaw);
+    pGui->sImgRefBkgnd = gslc_ResetImage();
+  }
+
+  // The solid background is filled directly by gslc_DrvDrawBkgnd()
+  pDriver->nColBkgnd = nCol;
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+
+  // Dispose of previous image
+  if (pImgRef->eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pImgRef->pvImgRaw);
+    *pImgRef = gslc_ResetImage();
+  }
+
+  *pImgRef = sImgRef;
+  pImgRef->pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (pImgRef->pvImgRaw == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
+{
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,true,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+
+  // Dispose of previous image
+  if (pImgRef->eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pImgRef->pvImgRaw);
+    *pImgRef = gslc_ResetImage();
+  }
+
+  *pImgRef = sImgRef;
+  pImgRef->pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (pImgRef->pvImgRaw == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
+    return false;
+  }
+  return true;
+}
+
+
+void gslc_DrvImageDestruct(void* pvImg)
+{
+  if (pvImg == NULL) {
+    return;
+  }
+  gslc_tsDrvMemImage* pImg = (gslc_tsDrvMemImage*)pvImg;
+  free(pImg->pPixels);
+  free(pImg->pMask);
+  free(pImg);
+}
+
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsRect    rFull   = (gslc_tsRect){0,0,pDriver->nFrameW,pDriver->nFrameH};
+  if (pRect == NULL) {
+    pDriver->rClipRect = rFull;
+  } else {
+    // Constrain the clip region to the framebuffer so that
+    // the primitives only need to check against the clip
+    pDriver->rClipRect = *pRect;
+    if (!gslc_ClipRect(&rFull,&(pDriver->rClipRect))) {
+      pDriver->rClipRect = (gslc_tsRect){0,0,0,0};
+    }
+  }
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz)
+{
+  (void)eFontRefType; // Unused
+  (void)nFontSz; // Unused
+  // All text is rendered with the built-in font, so the reference
+  // is only retained. The scale is derived from the font size.
+  return pvFontRef;
+}
+
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
+{
+  (void)pGui;
+  // Nothing to deallocate
+}
+
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH)
+{
+  uint8_t   nScale    = gslc_DrvMemFontScale(pFont);
+  uint16_t  nLineLen  = 0;
+  uint16_t  nMaxLen   = 0;
+  uint16_t  nLines    = 1;
+  char      ch;
+
+  while (1) {
+    ch = gslc_DrvMemNextChar(&pStr,eTxtFlags);
+    if (ch == '\0') {
+      break;
+    } else if (ch == '\n') {
+      nLines++;
+      nLineLen = 0;
+    } else {
+      nLineLen++;
+      if (nLineLen > nMaxLen) { nMaxLen = nLineLen; }
+    }
+  }
+
+  *pnTxtSzW = nMaxLen * DRV_MEM_FONT_W * nScale;
+  *pnTxtSzH = nLines * DRV_MEM_FONT_H * nScale;
+  // No offset coordinates used
+  *pnTxtX = 0;
+  *pnTxtY = 0;
+  return true;
+}
+
+
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt, gslc_tsColor colBg)
+{
+  (void)colBg; // Text is always drawn with transparent background
+  if ((pGui == NULL) || (pFont == NULL)) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawTxt(%s) with NULL ptr\n","");
+    return false;
+  }
+  if (pStr == NULL) {
+    return true;
+  }
+
+  gslc_tsDriver*  pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t         nScale  = gslc_DrvMemFontScale(pFont);
+  pDriver->nDrawCnt++;
+  int16_t         nCurX   = nTxtX;
+  int16_t         nCurY   = nTxtY;
+  uint8_t         anPixel[DRV_MEM_PIXEL_BYTES];
+  uint8_t         nCol,nRow,nBits;
+  char            ch;
+
+  gslc_DrvMemAdaptColorRaw(colTxt,anPixel);
+
+  while (1) {
+    ch = gslc_DrvMemNextChar(&pStr,eTxtFlags);
+    if (ch == '\0') {
+      break;
+    } else if (ch == '\n') {
+      nCurX  = nTxtX;
+      nCurY += DRV_MEM_FONT_H * nScale;
+      continue;
+    }
+    if ((ch < DRV_MEM_FONT_FIRST) || (ch > DRV_MEM_FONT_LAST)) {
+      ch = '?';
+    }
+    const uint8_t* pGlyph = &m_acDrvMemFont[(ch-DRV_MEM_FONT_FIRST)*5];
+    for (nCol=0;nCol<5;nCol++) {
+      nBits = pGlyph[nCol];
+      for (nRow=0;nRow<DRV_MEM_FONT_H;nRow++) {
+        if (nBits & (1 << nRow)) {
+          gslc_tsRect rDot = (gslc_tsRect){ nCurX+nCol*nScale, nCurY+nRow*nScale, nScale, nScale };
+          if (gslc_ClipRect(&(pDriver->rClipRect),&rDot)) {
+            int16_t nY;
+            for (nY=rDot.y;nY<rDot.y+rDot.h;nY++) {
+              gslc_DrvMemFillSpan(pGui,rDot.x,nY,rDot.w,anPixel);
+            }
+          }
+        }
+      }
+    }
+    nCurX += DRV_MEM_FONT_W * nScale;
+  }
+
+  return true;
+}
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  // Nothing to present; the framebuffer is always current
+  pDriver->nFrameCnt++;
+  pDriver->nFlipPixelCnt += (uint32_t)pDriver->nFrameW * pDriver->nFrameH;
+}
+
+void gslc_DrvPageFlipRects(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t nInd;
+  pDriver->nFrameCnt++;
+  for (nInd=0;nInd<nRectCnt;nInd++) {
+    pDriver->nFlipPixelCnt += (uint32_t)asRect[nInd].w * asRect[nInd].h;
+  }
+}
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        anPixel[DRV_MEM_PIXEL_BYTES];
+  pDriver->nDrawCnt++;
+  if (!gslc_ClipPt(&(pDriver->rClipRect),nX,nY)) { return true; }
+  gslc_DrvMemAdaptColorRaw(nCol,anPixel);
+  gslc_DrvMemFillSpan(pGui,nX,nY,1,anPixel);
+  return true;
+}
+
+
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        anPixel[DRV_MEM_PIXEL_BYTES];
+  uint16_t       nIndPt;
+  pDriver->nDrawCnt++;
+  gslc_DrvMemAdaptColorRaw(nCol,anPixel);
+  for (nIndPt=0;nIndPt<nNumPt;nIndPt++) {
+    if (gslc_ClipPt(&(pDriver->rClipRect),asPt[nIndPt].x,asPt[nIndPt].y)) {
+      gslc_DrvMemFillSpan(pGui,asPt[nIndPt].x,asPt[nIndPt].y,1,anPixel);
+    }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nDrawCnt++;
+  return gslc_DrvMemFillRect(pGui,rRect,nCol);
+}
+
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  int16_t nX0 = rRect.x;
+  int16_t nY0 = rRect.y;
+  int16_t nX1 = rRect.x + rRect.w - 1;
+  int16_t nY1 = rRect.y + rRect.h - 1;
+
+  pDriver->nDrawCnt++;
+  if ((rRect.w == 0) || (rRect.h == 0)) { return true; }
+
+  // Edges are drawn as clipped fills
+  gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX0,nY0,rRect.w,1},nCol);
+  if (rRect.h > 1) {
+    gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX0,nY1,rRect.w,1},nCol);
+  }
+  if (rRect.h > 2) {
+    gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX0,nY0+1,1,rRect.h-2},nCol);
+    if (rRect.w > 1) {
+      gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX1,nY0+1,1,rRect.h-2},nCol);
+    }
+  }
+  return true;
+}
+
+
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t        anPixel[DRV_MEM_PIXEL_BYTES];
+  pDriver->nDrawCnt++;
+
+  // Horizontal and vertical lines become fills
+  if (nY0 == nY1) {
+    if (nX0 > nX1) { int16_t nTmp = nX0; nX0 = nX1; nX1 = nTmp; }
+    return gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX0,nY0,(uint16_t)(nX1-nX0+1),1},nCol);
+  } else if (nX0 == nX1) {
+    if (nY0 > nY1) { int16_t nTmp = nY0; nY0 = nY1; nY1 = nTmp; }
+    return gslc_DrvMemFillRect(pGui,(gslc_tsRect){nX0,nY0,1,(uint16_t)(nY1-nY0+1)},nCol);
+  }
+
+  if (!gslc_ClipLine(&(pDriver->rClipRect),&nX0,&nY0,&nX1,&nY1)) { return true; }
+
+  gslc_DrvMemAdaptColorRaw(nCol,anPixel);
+
+  // Bresenham
+  int16_t nDX  = (nX1 > nX0)? (nX1-nX0) : (nX0-nX1);
+  int16_t nDY  = (nY1 > nY0)? (nY0-nY1) : (nY1-nY0);
+  int16_t nSX  = (nX0 < nX1)? 1 : -1;
+  int16_t nSY  = (nY0 < nY1)? 1 : -1;
+  int32_t nErr = nDX + nDY;
+  int32_t nErr2;
+  while (1) {
+    // Guard against any rounding in the line clipper
+    if (gslc_ClipPt(&(pDriver->rClipRect),nX0,nY0)) {
+      gslc_DrvMemFillSpan(pGui,nX0,nY0,1,anPixel);
+    }
+    if ((nX0 == nX1) && (nY0 == nY1)) { break; }
+    nErr2 = 2*nErr;
+    if (nErr2 >= nDY) { nErr += nDY; nX0 += nSX; }
+    if (nErr2 <= nDX) { nErr += nDX; nY0 += nSY; }
+  }
+  return true;
+}
+
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawImage(%s) with NULL ptr\n","");
+    return false;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nDrawCnt++;
+  return gslc_DrvMemDrawImage(pGui,nDstX,nDstY,sImgRef);
+}
+
+
+/// NOTE: Background image is stored in pGui->sImgRefBkgnd
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvDrawBkgnd(%s) with NULL ptr\n","");
+    return;
+  }
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nDrawCnt++;
+
+  if (pGui->sImgRefBkgnd.pvImgRaw != NULL) {
+    // Transparent regions of a background image show the color
+    gslc_DrvMemFillRect(pGui,pDriver->rClipRect,pDriver->nColBkgnd);
+    gslc_DrvMemDrawImage(pGui,0,0,pGui->sImgRefBkgnd);
+  } else {
+    // Only the clipped region needs to be filled
+    gslc_DrvMemFillRect(pGui,pDriver->rClipRect,pDriver->nColBkgnd);
+  }
+}
+
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pDriver->nFrameW) || (rRect.y + rRect.h > pDriver->nFrameH)) {
+    return false;
+  }
+  uint32_t nRowBytes = (uint32_t)rRect.w * DRV_MEM_PIXEL_BYTES;
+  if ((uint32_t)rRect.h * nRowBytes > nBufSize) {
+    return false;
+  }
+  uint8_t* pDst = (uint8_t*)pvBuf;
+  const uint8_t* pSrc = pDriver->pFrameBuf + (uint32_t)rRect.y*pDriver->nFramePitch + (uint32_t)rRect.x*DRV_MEM_PIXEL_BYTES;
+  for (uint16_t nRow=0;nRow<rRect.h;nRow++) {
+    memcpy(pDst,pSrc,nRowBytes);
+    pDst += nRowBytes;
+    pSrc += pDriver->nFramePitch;
+  }
+  return true;
+}
+
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pDriver->nFrameW) || (rRect.y + rRect.h > pDriver->nFrameH)) {
+    return false;
+  }
+  pDriver->nDrawCnt++;
+  uint32_t nRowBytes = (uint32_t)rRect.w * DRV_MEM_PIXEL_BYTES;
+  const uint8_t* pSrc = (const uint8_t*)pvBuf;
+  uint8_t* pDst = pDriver->pFrameBuf + (uint32_t)rRect.y*pDriver->nFramePitch + (uint32_t)rRect.x*DRV_MEM_PIXEL_BYTES;
+  for (uint16_t nRow=0;nRow<rRect.h;nRow++) {
+    memcpy(pDst,pSrc,nRowBytes);
+    pDst += pDriver->nFramePitch;
+    pSrc += nRowBytes;
+  }
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if ((rSrc.x < 0) || (rSrc.y < 0) ||
+      (rSrc.x + rSrc.w > pDriver->nFrameW) || (rSrc.y + rSrc.h > pDriver->nFrameH)) {
+    return false;
+  }
+  if ((rSrc.w == 0) || (rSrc.h == 0)) { return true; }
+
+  // Clip the destination and trim the source to match
+  gslc_tsRect rDst = (gslc_tsRect){nDstX,nDstY,rSrc.w,rSrc.h};
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rDst)) { return true; }
+  rSrc.x += rDst.x - nDstX;
+  rSrc.y += rDst.y - nDstY;
+  pDriver->nDrawCnt++;
+
+  // Walk the rows away from the overlap so that source rows
+  // are read before they are overwritten
+  uint32_t nRowBytes = (uint32_t)rDst.w * DRV_MEM_PIXEL_BYTES;
+  uint8_t* pSrc = pDriver->pFrameBuf + (uint32_t)rSrc.y*pDriver->nFramePitch + (uint32_t)rSrc.x*DRV_MEM_PIXEL_BYTES;
+  uint8_t* pDst = pDriver->pFrameBuf + (uint32_t)rDst.y*pDriver->nFramePitch + (uint32_t)rDst.x*DRV_MEM_PIXEL_BYTES;
+  int32_t  nStep = (int32_t)pDriver->nFramePitch;
+  if (rDst.y > rSrc.y) {
+    pSrc += (uint32_t)(rDst.h-1)*pDriver->nFramePitch;
+    pDst += (uint32_t)(rDst.h-1)*pDriver->nFramePitch;
+    nStep = -nStep;
+  }
+  for (uint16_t nRow=0;nRow<rDst.h;nRow++) {
+    memmove(pDst,pSrc,nRowBytes);
+    pDst += nStep;
+    pSrc += nStep;
+  }
+  return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Touch Functions (via injected events)
+// ------------------------------------------------------------------------
+
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev)
+{
+  (void)acDev; // Unused
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvInitTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+  #if defined(DRV_TOUCH_MEM)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pDriver->nTouchQueueHead = 0;
+  pDriver->nTouchQueueCnt  = 0;
+  #endif
+  return true;
+}
+
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui)
+{
+  return NULL;
+}
+
+
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal)
+{
+  if (pGui == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGetTouch(%s) called with NULL ptr\n","");
+    return false;
+  }
+
+  *peInputEvent = GSLC_INPUT_NONE;
+
+  #if defined(DRV_TOUCH_MEM)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->nTouchQueueCnt == 0) {
+    return false;
+  }
+  gslc_tsDrvMemTouch* pTouch = &(pDriver->asTouchQueue[pDriver->nTouchQueueHead]);
+  *pnX          = pTouch->nX;
+  *pnY          = pTouch->nY;
+  *pnPress      = pTouch->nPress;
+  *peInputEvent = GSLC_INPUT_TOUCH;
+  *pnInputVal   = 0;
+  pDriver->nTouchQueueHead = (pDriver->nTouchQueueHead + 1) % DRV_MEM_TOUCH_QUEUE;
+  pDriver->nTouchQueueCnt--;
+  return true;
+  #else
+  (void)pnX; (void)pnY; (void)pnPress; (void)pnInputVal;
+  return false;
+  #endif
+}
+
+
+/// Change display rotation and any associated touch orientation
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation)
+{
+  if (nRotation > 3) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvRotate(%u) invalid rotation\n",nRotation);
+    return false;
+  }
+  pGui->nRotation = nRotation;
+  if (!gslc_DrvMemAlloc(pGui)) {
+    return false;
+  }
+  // Invalidate the new dimensions
+  gslc_InvalidateRgnScreen(pGui);
+  gslc_PageFlipSet(pGui,true);
+  return true;
+}
+
+
+// =======================================================================
+// Public APIs specific to the in-memory framebuffer
+// =======================================================================
+
+bool gslc_DrvMemSavePpm(gslc_tsGui* pGui,const char* pFname)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  FILE*          pFile;
+  uint8_t*       pRow;
+  int16_t        nX,nY;
+
+  pFile = fopen(pFname,"wb");
+  if (pFile == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvMemSavePpm(%s) failed to open\n",pFname);
+    return false;
+  }
+  pRow = (uint8_t*)malloc((size_t)pDriver->nFrameW*3);
+  if (pRow == NULL) {
+    fclose(pFile);
+    return false;
+  }
+
+  fprintf(pFile,"P6\n%u %u\n255\n",pDriver->nFrameW,pDriver->nFrameH);
+  for (nY=0;nY<pDriver->nFrameH;nY++) {
+    for (nX=0;nX<pDriver->nFrameW;nX++) {
+      gslc_tsColor nCol = gslc_DrvMemGetPixel(pGui,nX,nY);
+      pRow[nX*3+0] = nCol.r;
+      pRow[nX*3+1] = nCol.g;
+      pRow[nX*3+2] = nCol.b;
+    }
+    fwrite(pRow,3,pDriver->nFrameW,pFile);
+  }
+
+  free(pRow);
+  fclose(pFile);
+  return true;
+}
+
+gslc_tsColor gslc_DrvMemGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsColor   nCol    = GSLC_COL_BLACK;
+  if ((nX < 0) || (nY < 0) || (nX >= pDriver->nFrameW) || (nY >= pDriver->nFrameH)) {
+    return nCol;
+  }
+  const uint8_t* pPixel = pDriver->pFrameBuf + (uint32_t)nY*pDriver->nFramePitch + (uint32_t)nX*DRV_MEM_PIXEL_BYTES;
+  #if (DRV_MEM_BPP == 16)
+  uint16_t nRaw = *(const uint16_t*)pPixel;
+  // Expand to 8 bits per channel, replicating the high bits
+  nCol.r = (uint8_t)(((nRaw >> 8) & 0xF8) | ((nRaw >> 13) & 0x07));
+  nCol.g = (uint8_t)(((nRaw >> 3) & 0xFC) | ((nRaw >>  9) & 0x03));
+  nCol.b = (uint8_t)(((nRaw << 3) & 0xF8) | ((nRaw >>  2) & 0x07));
+  #else
+  nCol.r = pPixel[0];
+  nCol.g = pPixel[1];
+  nCol.b = pPixel[2];
+  #endif
+  return nCol;
+}
+
+uint32_t gslc_DrvMemGetFrameCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->nFrameCnt;
+}
+
+uint32_t gslc_DrvMemGetDrawCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->nDrawCnt;
+}
+
+uint32_t gslc_DrvMemGetFlipPixelCnt(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  return pDriver->nFlipPixelCnt;
+}
+
+#if defined(DRV_TOUCH_MEM)
+bool gslc_DrvMemQueueTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  if (pDriver->nTouchQueueCnt >= DRV_MEM_TOUCH_QUEUE) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvMemQueueTouch() queue full (%u)\n",DRV_MEM_TOUCH_QUEUE);
+    return false;
+  }
+  uint8_t nInd = (pDriver->nTouchQueueHead + pDriver->nTouchQueueCnt) % DRV_MEM_TOUCH_QUEUE;
+  pDriver->asTouchQueue[nInd].nX     = nX;
+  pDriver->asTouchQueue[nInd].nY     = nY;
+  pDriver->asTouchQueue[nInd].nPress = nPress;
+  pDriver->nTouchQueueCnt++;
+  return true;
+}
+#endif // DRV_TOUCH_MEM
+
+
+// =======================================================================
+// Private Functions
+// =======================================================================
+
+void gslc_DrvMemAdaptColorRaw(gslc_tsColor nCol,uint8_t* pPixel)
+{
+  #if (DRV_MEM_BPP == 16)
+  uint16_t nRaw = ((nCol.r & 0xF8) << 8) | ((nCol.g & 0xFC) << 3) | (nCol.b >> 3);
+  memcpy(pPixel,&nRaw,2);
+  #else
+  pPixel[0] = nCol.r;
+  pPixel[1] = nCol.g;
+  pPixel[2] = nCol.b;
+  #endif
+}
+
+void gslc_DrvMemFillSpan(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,const uint8_t* pPixel)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint8_t*       pDst    = pDriver->pFrameBuf + (uint32_t)nY*pDriver->nFramePitch + (uint32_t)nX*DRV_MEM_PIXEL_BYTES;
+  uint16_t       nInd;
+  #if (DRV_MEM_BPP == 16)
+  uint16_t nRaw;
+  memcpy(&nRaw,pPixel,2);
+  uint16_t* pDst16 = (uint16_t*)pDst;
+  for (nInd=0;nInd<nW;nInd++) {
+    pDst16[nInd] = nRaw;
+  }
+  #else
+  for (nInd=0;nInd<nW;nInd++) {
+    pDst[0] = pPixel[0];
+    pDst[1] = pPixel[1];
+    pDst[2] = pPixel[2];
+    pDst += 3;
+  }
+  #endif
+}
+
+#endif // DRV_DISP_MEM
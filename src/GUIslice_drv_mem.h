@@ -0,0 +1,701 @@
+#ifndef _GUISLICE_DRV_MEM_H_
+#define _GUISLICE_DRV_MEM_H_
+
+// =======================================================================
+// GUIslice library (driver layer for in-memory framebuffer)
+// - Calvin Hass
+// - https://www.impulseadventure.com/elec/guislice-gui.html
+// - https://github.com/ImpulseAdventure/GUIslice
+// =======================================================================
+//
+// The MIT License
+//
+// Copyright 2016-2020 Calvin Hass
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+// THE SOFTWARE.
+//
+// =======================================================================
+/// \file GUIslice_drv_mem.h
+/// \brief GUIslice library (driver layer for headless in-memory framebuffer)
+
+
+// =======================================================================
+// Driver Layer for in-memory framebuffer
+// - Renders into a RAM buffer without any display hardware, which
+//   makes it suitable for headless testing, benchmarking and
+//   capturing screenshots (PPM) of a GUI on any LINUX host.
+// =======================================================================
+
+#ifdef __cplusplus
+extern "C" {
+#endif // __cplusplus
+
+#include "GUIslice.h"
+
+#include <stdio.h>
+
+// =======================================================================
+// Framebuffer configuration
+// - These may be overridden in the config file
+// =======================================================================
+
+// Native (unrotated) dimensions of the framebuffer
+#if !defined(DRV_MEM_WIDTH)
+  #define DRV_MEM_WIDTH   320
+#endif
+#if !defined(DRV_MEM_HEIGHT)
+  #define DRV_MEM_HEIGHT  240
+#endif
+
+// Framebuffer pixel format
+// - 16 = RGB565 (native endian uint16_t per pixel)
+// - 24 = RGB888 (packed R,G,B bytes per pixel)
+#if !defined(DRV_MEM_BPP)
+  #define DRV_MEM_BPP     16
+#endif
+
+#if (DRV_MEM_BPP == 16)
+  #define DRV_MEM_PIXEL_BYTES  2
+#elif (DRV_MEM_BPP == 24)
+  #define DRV_MEM_PIXEL_BYTES  3
+#else
+  #error "DRV_MEM_BPP must be 16 or 24"
+#endif
+
+// Maximum number of injected touch events that can be queued
+#if !defined(DRV_MEM_TOUCH_QUEUE)
+  #define DRV_MEM_TOUCH_QUEUE  16
+#endif
+
+// =======================================================================
+// API support definitions
+// - These defines indicate whether the driver includes optimized
+//   support for various APIs. If a define is set to 0, then the
+//   GUIslice core emulation will be used instead.
+// - At the very minimum, the point draw routine must be available:
+//   gslc_DrvDrawPoint()
+// =======================================================================
+
+#define DRV_HAS_DRAW_POINT             1 ///< Support gslc_DrvDrawPoint()
+
+#define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
+#define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+#define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
+#define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
+#define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
+#define DRV_HAS_DRAW_CIRCLE_FRAME      0 ///< Support gslc_DrvDrawFrameCircle()
+#define DRV_HAS_DRAW_CIRCLE_FILL       0 ///< Support gslc_DrvDrawFillCircle()
+#define DRV_HAS_DRAW_TRI_FRAME         0 ///< Support gslc_DrvDrawFrameTriangle()
+#define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
+#define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
+#define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_SAVE_RECT              1 ///< Support gslc_DrvSaveRect() and gslc_DrvRestoreRect()
+#define DRV_HAS_FLIP_RECTS             1 ///< Support gslc_DrvPageFlipRects()
+#define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
+
+#define DRV_OVERRIDE_TXT_ALIGN         0 ///< Driver provides text alignment
+
+// =======================================================================
+// Driver-specific members
+// =======================================================================
+
+/// Injected touch event (DRV_TOUCH_MEM)
+typedef struct {
+  int16_t             nX;               ///< Touch X coordinate
+  int16_t             nY;               ///< Touch Y coordinate
+  uint16_t            nPress;           ///< Touch pressure (0 for release)
+} gslc_tsDrvMemTouch;
+
+typedef struct {
+
+  uint8_t*            pFrameBuf;        ///< Framebuffer pixel data
+  uint16_t            nFrameW;          ///< Framebuffer width (current rotation)
+  uint16_t            nFrameH;          ///< Framebuffer height (current rotation)
+  uint32_t            nFramePitch;      ///< Framebuffer bytes per row
+  uint32_t            nFrameCnt;        ///< Number of page flips performed
+  uint32_t            nFlipPixelCnt;    ///< Number of pixels presented by page flips
+  uint32_t            nDrawCnt;         ///< Number of drawing primitive calls received
+  gslc_tsColor        nColBkgnd;        ///< Background color (if no background image)
+
+  #if defined(DRV_TOUCH_MEM)
+  gslc_tsDrvMemTouch  asTouchQueue[DRV_MEM_TOUCH_QUEUE]; ///< Injected touch FIFO
+  uint8_t             nTouchQueueHead;  ///< Index of oldest queued touch
+  uint8_t             nTouchQueueCnt;   ///< Number of queued touches
+  #endif
+
+  gslc_tsRect         rClipRect;        ///< Clipping rectangle
+
+} gslc_tsDriver;
+
+/// Image loaded into framebuffer pixel format
+/// - Created by gslc_DrvLoadImage() and released by gslc_DrvImageDestruct()
+typedef struct {
+  uint16_t            nW;               ///< Image width
+  uint16_t            nH;               ///< Image height
+  uint8_t*            pPixels;          ///< Pixel data (DRV_MEM_PIXEL_BYTES per pixel)
+  uint8_t*            pMask;            ///< Opacity mask (1 byte per pixel), NULL if opaque
+} gslc_tsDrvMemImage;
+
+
+
+// =======================================================================
+// Public APIs to GUIslice core library
+// - These functions define the renderer / driver-dependent
+//   implementations for the core drawing operations within
+//   GUIslice.
+// =======================================================================
+
+
+// -----------------------------------------------------------------------
+// Configuration Functions
+// -----------------------------------------------------------------------
+
+///
+/// Initialize the in-memory framebuffer
+/// - Allocates the framebuffer according to DRV_MEM_WIDTH,
+///   DRV_MEM_HEIGHT, DRV_MEM_BPP and GSLC_ROTATE
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvInit(gslc_tsGui* pGui);
+
+
+///
+/// Free up any members associated with the driver
+/// - Releases the framebuffer
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the display driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameDisp(gslc_tsGui* pGui);
+
+
+///
+/// Get the touch driver name
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return String containing driver name
+///
+const char* gslc_DrvGetNameTouch(gslc_tsGui* pGui);
+
+///
+/// Get the native display driver instance
+/// - This can be useful to access special commands
+///   available in the selected driver.
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the driver-specific members (gslc_tsDriver)
+///
+void* gslc_DrvGetDriverDisp(gslc_tsGui* pGui);
+
+///
+/// Get the native touch driver instance
+/// - This can be useful to access special commands
+///   available in the selected driver.
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return Void pointer to the touch driver instance (NULL)
+///
+void* gslc_DrvGetDriverTouch(gslc_tsGui* pGui);
+
+// -----------------------------------------------------------------------
+// Image/surface handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a bitmap (*.bmp) and convert it into the framebuffer format
+/// - Supports uncompressed 24/32-bit BMP files, in-memory BMP24
+///   (RGB565 array) and RAW1 (monochrome) images
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  sImgRef:   Image reference
+///
+/// \return Image pointer (gslc_tsDrvMemImage*) or NULL if error
+///
+void* gslc_DrvLoadImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a bitmap image
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  sImgRef:   Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndImage(gslc_tsGui* pGui,gslc_tsImgRef sImgRef);
+
+
+///
+/// Configure the background to use a solid color
+/// - The background is used when redrawing the entire page
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nCol:      RGB Color to use
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol);
+
+
+///
+/// Set an element's normal-state image
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  pElem:     Pointer to Element to update
+/// \param[in]  sImgRef:   Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Set an element's glow-state image
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  pElem:     Pointer to Element to update
+/// \param[in]  sImgRef:   Image reference
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef);
+
+
+///
+/// Release an image surface
+///
+/// \param[in]  pvImg:          Void ptr to image
+///
+/// \return none
+///
+void gslc_DrvImageDestruct(void* pvImg);
+
+
+///
+/// Set the clipping rectangle for future drawing updates
+///
+/// \param[in]  pGui:          Pointer to GUI
+/// \param[in]  pRect:         Rectangular region to constrain edits
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect);
+
+
+// -----------------------------------------------------------------------
+// Font handling Functions
+// -----------------------------------------------------------------------
+
+///
+/// Load a font from a resource and return pointer to it
+/// - The driver renders all text with its built-in 5x7 bitmap font,
+///   so the font reference itself is only retained for identification
+/// - For GSLC_FONTREF_PTR the font size is used as the text scale
+///   factor, while for GSLC_FONTREF_FNAME it is treated as a pixel
+///   height (as with SDL_ttf) and mapped to the nearest scale factor
+///
+/// \param[in]  eFontRefType:   Font reference type
+/// \param[in]  pvFontRef:      Font reference pointer
+/// \param[in]  nFontSz:        Typeface size to use
+///
+/// \return Void ptr to driver-specific font if load was successful, NULL otherwise
+///
+const void* gslc_DrvFontAdd(gslc_teFontRefType eFontRefType,const void* pvFontRef,uint16_t nFontSz);
+
+///
+/// Release all fonts defined in the GUI
+///
+/// \param[in]  pGui:          Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvFontsDestruct(gslc_tsGui* pGui);
+
+
+///
+/// Get the extent (width and height) of a text string
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  pFont:     Ptr to Font structure
+/// \param[in]  pStr:      String to display
+/// \param[in]  eTxtFlags: Flags associated with text string
+/// \param[out] pnTxtX:    Ptr to offset X of text
+/// \param[out] pnTxtY:    Ptr to offset Y of text
+/// \param[out] pnTxtSzW:  Ptr to width of text
+/// \param[out] pnTxtSzH:  Ptr to height of text
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvGetTxtSize(gslc_tsGui* pGui,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,
+        int16_t* pnTxtX,int16_t* pnTxtY,uint16_t* pnTxtSzW,uint16_t* pnTxtSzH);
+
+
+///
+/// Draw a text string at the given coordinate
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nTxtX:     X coordinate of top-left text string
+/// \param[in]  nTxtY:     Y coordinate of top-left text string
+/// \param[in]  pFont:     Ptr to Font
+/// \param[in]  pStr:      String to display
+/// \param[in]  eTxtFlags: Flags associated with text string
+/// \param[in]  colTxt:    Color to draw text
+/// \param[in]  colBg:     unused in this driver, text is drawn transparently
+///
+/// \return true if success, false if failure
+///
+bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* pFont,const char* pStr,gslc_teTxtFlags eTxtFlags,gslc_tsColor colTxt,gslc_tsColor colBg);
+
+
+// -----------------------------------------------------------------------
+// Screen Management Functions
+// -----------------------------------------------------------------------
+
+///
+/// Complete a frame update
+/// - The framebuffer is always up to date, so this only
+///   advances the frame counter
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
+
+
+///
+/// Complete a frame update that only changed the given regions
+/// - As with gslc_DrvPageFlipNow(), this only updates the counters
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  asRect:    Array of changed regions
+/// \param[in]  nRectCnt:  Number of entries in asRect
+///
+/// \return none
+///
+void gslc_DrvPageFlipRects(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt);
+
+
+// -----------------------------------------------------------------------
+// Graphics Primitives Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nX:        X coordinate of point
+/// \param[in]  nY:        Y coordinate of point
+/// \param[in]  nCol:      Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoint(gslc_tsGui* pGui,int16_t nX,int16_t nY,gslc_tsColor nCol);
+
+///
+/// Draw a point
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  asPt:      Array of points to draw
+/// \param[in]  nNumPt:    Number of points in array
+/// \param[in]  nCol:      Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawPoints(gslc_tsGui* pGui,gslc_tsPt* asPt,uint16_t nNumPt,gslc_tsColor nCol);
+
+///
+/// Draw a framed rectangle
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  rRect:     Rectangular region to frame
+/// \param[in]  nCol:      Color RGB value to frame
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a filled rectangle
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  rRect:     Rectangular region to fill
+/// \param[in]  nCol:      Color RGB value to fill
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol);
+
+
+///
+/// Draw a line
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nX0:       Line start (X coordinate)
+/// \param[in]  nY0:       Line start (Y coordinate)
+/// \param[in]  nX1:       Line finish (X coordinate)
+/// \param[in]  nY1:       Line finish (Y coordinate)
+/// \param[in]  nCol:      Color RGB value to draw
+///
+/// \return true if success, false if error
+///
+bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol);
+
+
+///
+/// Copy all of source image to destination screen at specified coordinate
+///
+/// \param[in]  pGui:      Pointer to GUI
+/// \param[in]  nDstX:     Destination X coord for copy
+/// \param[in]  nDstY:     Destination Y coord for copy
+/// \param[in]  sImgRef:   Image reference
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRef sImgRef);
+
+
+///
+/// Copy the background image to destination screen
+///
+/// \param[in]  pGui:      Pointer to GUI
+///
+/// \return true if success, false if fail
+///
+void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
+
+
+///
+/// Copy a region of the display into a buffer
+/// - The buffer holds DRV_MEM_PIXEL_BYTES per pixel
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region to save (must be on-screen)
+/// \param[out] pvBuf:       Buffer to receive the pixel data
+/// \param[in]  nBufSize:    Size of pvBuf (in bytes)
+///
+/// \return true if success, false if the buffer is too small
+///
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize);
+
+
+///
+/// Copy a region saved by gslc_DrvSaveRect() back to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region that was saved
+/// \param[in]  pvBuf:       Buffer holding the pixel data
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf);
+
+
+///
+/// Copy a region of the display to another position on the display
+/// - Source and destination may overlap (eg. to scroll a region)
+/// - The destination is clipped to the current clip region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Display region to copy (must be on-screen)
+/// \param[in]  nDstX:       Destination X coordinate of the copy
+/// \param[in]  nDstY:       Destination Y coordinate of the copy
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+
+
+// -----------------------------------------------------------------------
+// Touch Functions (if using injected touch events)
+// -----------------------------------------------------------------------
+
+///
+/// Get the last touch event from the injected touch queue
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnX:         Ptr to X coordinate of last touch event
+/// \param[out] pnY:         Ptr to Y coordinate of last touch event
+/// \param[out] pnPress:     Ptr to Pressure level of last touch event (0 for none, >0 for touch)
+/// \param[out] peInputEvent Indication of event type
+/// \param[out] pnInputVal   Additional data for event type
+///
+/// \return true if an event was detected or false otherwise
+///
+bool gslc_DrvGetTouch(gslc_tsGui* pGui,int16_t* pnX,int16_t* pnY,uint16_t* pnPress,gslc_teInputRawEvent* peInputEvent,int16_t* pnInputVal);
+
+
+// -----------------------------------------------------------------------
+// Dynamic Screen rotation and Touch axes swap/flip functions
+// -----------------------------------------------------------------------
+
+///
+/// Change rotation, automatically adapt touchscreen axes swap/flip
+/// - The framebuffer is reallocated in the new orientation and cleared
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nRotation:   Screen Rotation value (0, 1, 2 or 3)
+///
+/// \return true if successful
+///
+bool gslc_DrvRotate(gslc_tsGui* pGui, uint8_t nRotation);
+
+
+// =======================================================================
+// Public APIs specific to the in-memory framebuffer
+// =======================================================================
+
+///
+/// Write the current framebuffer contents to a binary PPM (P6) file
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pFname:      Output filename
+///
+/// \return true if successful
+///
+bool gslc_DrvMemSavePpm(gslc_tsGui* pGui,const char* pFname);
+
+///
+/// Read back a single pixel from the framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+///
+/// \return Pixel color (black if out of range)
+///
+gslc_tsColor gslc_DrvMemGetPixel(gslc_tsGui* pGui,int16_t nX,int16_t nY);
+
+///
+/// Get the number of page flips performed since init
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Frame count
+///
+uint32_t gslc_DrvMemGetFrameCnt(gslc_tsGui* pGui);
+
+///
+/// Get the number of drawing primitive calls received since init
+/// - Counts each gslc_DrvDraw*() call made by the core, not
+///   the internal operations used to implement it
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Draw call count
+///
+uint32_t gslc_DrvMemGetDrawCnt(gslc_tsGui* pGui);
+
+///
+/// Get the number of pixels presented by page flips since init
+/// - A full page flip counts the entire framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return Pixel count
+///
+uint32_t gslc_DrvMemGetFlipPixelCnt(gslc_tsGui* pGui);
+
+#if defined(DRV_TOUCH_MEM)
+///
+/// Queue a synthetic touch event for delivery via gslc_DrvGetTouch()
+/// - A press is indicated by nPress>0, a release by nPress=0
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate
+/// \param[in]  nY:          Y coordinate
+/// \param[in]  nPress:      Pressure level (0 for release)
+///
+/// \return true if queued, false if the queue is full
+///
+bool gslc_DrvMemQueueTouch(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nPress);
+#endif // DRV_TOUCH_MEM
+
+
+// =======================================================================
+// Private Functions
+// - These functions are not included in the scope of APIs used by
+//   the core GUIslice library. Instead, these functions are used
+//   to support the operations within this driver layer.
+// =======================================================================
+
+///
+/// Convert an RGB color into the native framebuffer pixel encoding
+///
+/// \param[in]  nCol:        RGB color
+/// \param[out] pPixel:      Ptr to DRV_MEM_PIXEL_BYTES output bytes
+///
+/// \return none
+///
+void gslc_DrvMemAdaptColorRaw(gslc_tsColor nCol,uint8_t* pPixel);
+
+///
+/// Fill a horizontal span of pixels
+/// - The span must already be clipped to the framebuffer
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Starting X coordinate
+/// \param[in]  nY:          Y coordinate
+/// \param[in]  nW:          Number of pixels in span
+/// \param[in]  pPixel:      Ptr to native pixel value
+///
+/// \return none
+///
+void gslc_DrvMemFillSpan(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,const uint8_t* pPixel);
+
+
+// -----------------------------------------------------------------------
+// Private Touchscreen Functions
+// -----------------------------------------------------------------------
+
+///
+/// Perform any touchscreen-specific initialization
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  acDev:       Device path to touchscreen (unused)
+///
+/// \return true if successful
+///
+bool gslc_DrvInitTouch(gslc_tsGui* pGui,const char* acDev);
+
+
+#ifdef __cplusplus
+}
+#endif // __cplusplus
+#endif // _GUISLICE_DRV_MEM_H_
@@ -43,6 +43,8 @@
 #include "GUIslice_drv_sdl.h"
 
 #include <stdio.h>
+#include <stdlib.h>     // For free()
+#include <string.h>     // For strdup(), strcmp(), memset(), memcpy(), memmove()
 
 // ------------------------------------------------------------------------
 // Load display & touch drivers
@@ -72,6 +74,40 @@
   const char* m_acDrvTouch = "SDL";
 #endif
 
+#if defined(DRV_DISP_SDL1)
+// Store a raw pixel value at the given surface address
+// - Shared by the single pixel and span writers so that the
+//   per-format handling lives in one place
+static inline void gslc_DrvStorePixelRaw(uint8_t* pPixel,uint8_t nBpp,uint32_t nPixelVal)
+{
+  switch(nBpp) {
+    case 1:
+      *pPixel = nPixelVal;
+      break;
+
+    case 2:
+      *(uint16_t *)pPixel = nPixelVal;
+      break;
+
+    case 3:
+      if (SDL_BYTEORDER == SDL_BIG_ENDIAN) {
+        pPixel[0] = (nPixelVal >> 16) & 0xff;
+        pPixel[1] = (nPixelVal >> 8) & 0xff;
+        pPixel[2] = nPixelVal & 0xff;
+      } else {
+        pPixel[0] = nPixelVal & 0xff;
+        pPixel[1] = (nPixelVal >> 8) & 0xff;
+        pPixel[2] = (nPixelVal >> 16) & 0xff;
+      }
+      break;
+
+    case 4:
+      *(uint32_t *)pPixel = nPixelVal;
+      break;
+  }
+}
+#endif // DRV_DISP_SDL1
+
 
 // =======================================================================
 // Public APIs to GUIslice core library
@@ -103,10 +139,24 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
     #if defined(DRV_DISP_SDL2)
     pDriver->pWind       = NULL;
     pDriver->pRender     = NULL;
-    // In SDL2, always need full page redraw since backbuffer
-    // is treated as invalidated after every RenderPresent()
+    pDriver->pTexTarget  = NULL;
+    #if (DRV_SDL_TXT_CACHE_MAX > 0)
+    memset(pDriver->asTxtCache,0,sizeof(pDriver->asTxtCache));
+    pDriver->nTxtCacheBytes = 0;
+    pDriver->nTxtCacheTick  = 0;
+    pDriver->nTxtCacheHit   = 0;
+    pDriver->nTxtCacheMiss  = 0;
+    #endif
+    // In SDL2, the backbuffer is treated as invalidated after
+    // every RenderPresent(), so default to full page redraw.
+    // This is re-enabled below if a render target is available.
     pGui->bRedrawPartialEn = false;
     #endif
+
+    #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+    memset(pDriver->asGlyphAtlas,0,sizeof(pDriver->asGlyphAtlas));
+    pDriver->nGlyphAtlasTick = 0;
+    #endif
   }
 
 
@@ -224,8 +274,36 @@ bool gslc_DrvInit(gslc_tsGui* pGui)
   // If we wanted to support scaling of the renderer, we would call
   // SDL_RenderSetLogicalSize() here. For now, don't scale.
 
+  #if (DRV_SDL_RENDER_TARGET)
+  // Draw into a persistent texture that is copied to the window
+  // during the page flip. Since the texture contents survive
+  // SDL_RenderPresent(), partial redraws can be supported.
+  if (SDL_RenderTargetSupported(pDriver->pRender)) {
+    pDriver->pTexTarget = SDL_CreateTexture(pDriver->pRender,SDL_PIXELFORMAT_RGBA8888,
+      SDL_TEXTUREACCESS_TARGET,pGui->nDispW,pGui->nDispH);
+    if (pDriver->pTexTarget == NULL) {
+      GSLC_DEBUG_PRINT("ERROR: DrvInit() error in SDL_CreateTexture(): %s\n",SDL_GetError());
+    } else if (SDL_SetRenderTarget(pDriver->pRender,pDriver->pTexTarget) != 0) {
+      GSLC_DEBUG_PRINT("ERROR: DrvInit() error in SDL_SetRenderTarget(): %s\n",SDL_GetError());
+      SDL_DestroyTexture(pDriver->pTexTarget);
+      pDriver->pTexTarget = NULL;
+    } else {
+      SDL_SetRenderDrawColor(pDriver->pRender,0x00,0x00,0x00,0xFF);
+      SDL_RenderClear(pDriver->pRender);
+      pGui->bRedrawPartialEn = true;
+    }
+  }
+  #endif // DRV_SDL_RENDER_TARGET
+
+  #if defined(DBG_DRIVER)
+  GSLC_DEBUG_PRINT("DBG: Render target: %s\n",(pDriver->pTexTarget)? "texture" : "none");
+  #endif
+
 #endif
 
+  // Default to an unclipped display
+  pDriver->rClipRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+
   // Initialize font engine
   if (TTF_Init() == -1) {
     GSLC_DEBUG_PRINT("ERROR: DrvInit(%s) error in TTF_Init()\n","");
@@ -251,6 +329,13 @@ void gslc_DrvDestruct(gslc_tsGui* pGui)
 {
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_DrvTxtCacheFlush(pGui);
+  #endif
+  if (pDriver->pTexTarget) {
+    SDL_DestroyTexture(pDriver->pTexTarget);
+    pDriver->pTexTarget = NULL;
+  }
   if (pDriver->pRender) {
     SDL_DestroyRenderer(pDriver->pRender);
     pDriver->pRender = NULL;
@@ -455,15 +540,20 @@ bool gslc_DrvSetBkgndColor(gslc_tsGui* pGui,gslc_tsColor nCol)
 
 bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+
   // Dispose of previous image
-  if (pElem->sImgRefNorm.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefNorm.pvImgRaw);
-    pElem->sImgRefNorm = gslc_ResetImage();
+  if (pImgRef->eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pImgRef->pvImgRaw);
+    *pImgRef = gslc_ResetImage();
   }
 
-  pElem->sImgRefNorm = sImgRef;
-  pElem->sImgRefNorm.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefNorm.pvImgRaw == NULL) {
+  *pImgRef = sImgRef;
+  pImgRef->pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (pImgRef->pvImgRaw == NULL) {
     GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageNorm(%s) failed\n","");
     return false;
   }
@@ -473,15 +563,20 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 
 bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef sImgRef)
 {
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,true,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+
   // Dispose of previous image
-  if (pElem->sImgRefGlow.eImgFlags != GSLC_IMGREF_NONE) {
-    gslc_DrvImageDestruct(pElem->sImgRefGlow.pvImgRaw);
-    pElem->sImgRefGlow = gslc_ResetImage();
+  if (pImgRef->eImgFlags != GSLC_IMGREF_NONE) {
+    gslc_DrvImageDestruct(pImgRef->pvImgRaw);
+    *pImgRef = gslc_ResetImage();
   }
 
-  pElem->sImgRefGlow = sImgRef;
-  pElem->sImgRefGlow.pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
-  if (pElem->sImgRefGlow.pvImgRaw == NULL) {
+  *pImgRef = sImgRef;
+  pImgRef->pvImgRaw = gslc_DrvLoadImage(pGui,sImgRef);
+  if (pImgRef->pvImgRaw == NULL) {
     GSLC_DEBUG2_PRINT("ERROR: DrvSetElemImageGlow(%s) failed\n","");
     return false;
   }
@@ -505,6 +600,15 @@ void gslc_DrvImageDestruct(void* pvImg)
 bool gslc_DrvSetClipRect(gslc_tsGui* pGui,gslc_tsRect* pRect)
 {
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+
+  // Retain the clip region so that it can be queried (and restored
+  // after switching SDL2 render targets)
+  if (pRect == NULL) {
+    pDriver->rClipRect = (gslc_tsRect){0,0,pGui->nDispW,pGui->nDispH};
+  } else {
+    pDriver->rClipRect = *pRect;
+  }
+
 #if defined(DRV_DISP_SDL1)
   SDL_Surface*  pScreen = pDriver->pSurfScreen;
   if (pRect == NULL) {
@@ -557,6 +661,14 @@ void gslc_DrvFontsDestruct(gslc_tsGui* pGui)
 {
   uint16_t  nFontInd;
   TTF_Font* pFont = NULL;
+  #if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  // Cached text refers to the fonts being released
+  gslc_DrvTxtCacheFlush(pGui);
+  #endif
+  #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  // Glyph atlases refer to the fonts being released
+  gslc_DrvGlyphAtlasFlush(pGui);
+  #endif
   for (nFontInd=0;nFontInd<pGui->nFontCnt;nFontInd++) {
     if (pGui->asFont[nFontInd].pvFont != NULL) {
       pFont = (TTF_Font*)(pGui->asFont[nFontInd].pvFont);
@@ -608,6 +720,25 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   SDL_Surface*    pSurfTxt  = NULL;
   TTF_Font*       pDrvFont  = (TTF_Font*)(pFont->pvFont);
   if (!pDrvFont) { return false; }
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  // Draw from the font's glyph atlas if the string permits
+  if (gslc_DrvGlyphAtlasDrawTxt(pGui,nTxtX,nTxtY,pDrvFont,pStr,colTxt)) {
+    return true;
+  }
+#endif
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  // Reuse a previously rendered texture if available
+  uint16_t     nCacheW,nCacheH;
+  SDL_Texture* pTexCache = gslc_DrvTxtCacheFind(pGui,pDrvFont,eTxtFlags,colTxt,pStr,&nCacheW,&nCacheH);
+  if (pTexCache != NULL) {
+    SDL_Rect rRectCache = (SDL_Rect){nTxtX,nTxtY,nCacheW,nCacheH};
+    SDL_RenderCopy(pDriver->pRender,pTexCache,NULL,&rRectCache);
+    return true;
+  }
+#endif
+
   if ((eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8) {
     pSurfTxt = TTF_RenderUTF8_Blended(pDrvFont,pStr,gslc_DrvAdaptColor(colTxt));
   } else {
@@ -632,10 +763,15 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
   }
   SDL_RenderCopy(pRender,pTex,NULL,&rRect);
 
-  // Destroy texture
-  // TODO: Consider if worth optimizing by retaining texture in case
-  //       we need to redraw it without changing content
+  // Retain the texture in case we need to redraw it without
+  // changing content, otherwise destroy it
+  #if (DRV_SDL_TXT_CACHE_MAX > 0)
+  if (!gslc_DrvTxtCacheAdd(pGui,pDrvFont,eTxtFlags,colTxt,pStr,pTex,pSurfTxt->w,pSurfTxt->h)) {
+    SDL_DestroyTexture(pTex);
+  }
+  #else
   SDL_DestroyTexture(pTex);
+  #endif
   pTex = NULL;
 #endif
 
@@ -662,7 +798,18 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 #endif
 #if defined(DRV_DISP_SDL2)
   SDL_Renderer* pRender = pDriver->pRender;
-  if (pRender) {
+  if ((pRender) && (pDriver->pTexTarget)) {
+    // Copy the persistent render target into the window backbuffer
+    // - The clip region applies only to drawing into the target
+    SDL_SetRenderTarget(pRender,NULL);
+    SDL_RenderSetClipRect(pRender,NULL);
+    SDL_RenderCopy(pRender,pDriver->pTexTarget,NULL,NULL);
+    SDL_RenderPresent(pRender);
+    // Resume drawing into the target without clearing it
+    // so that subsequent partial redraws retain the page
+    SDL_SetRenderTarget(pRender,pDriver->pTexTarget);
+    gslc_DrvSetClipRect(pGui,&(pDriver->rClipRect));
+  } else if (pRender) {
     // Flip the offscreen buffer so we can display our drawing output
     SDL_RenderPresent(pRender);
     // Clear the drawing before any new drawing occurs
@@ -672,6 +819,36 @@ void gslc_DrvPageFlipNow(gslc_tsGui* pGui)
 #endif
 }
 
+#if defined(DRV_DISP_SDL1)
+void gslc_DrvPageFlipRects(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Rect       asSdlRect[GSLC_INVALIDATE_RGN_MAX];
+  gslc_tsRect    rScreen = (gslc_tsRect) { 0, 0, (uint16_t)pScreen->w, (uint16_t)pScreen->h };
+  int            nSdlRectCnt = 0;
+  uint8_t        nInd;
+
+  // A double-buffered surface can only be presented in full
+  if ((pScreen->flags & SDL_DOUBLEBUF) || (nRectCnt > GSLC_INVALIDATE_RGN_MAX)) {
+    SDL_Flip(pScreen);
+    return;
+  }
+  for (nInd=0;nInd<nRectCnt;nInd++) {
+    gslc_tsRect rRect = asRect[nInd];
+    if (!gslc_ClipRect(&rScreen,&rRect)) {
+      continue;
+    }
+    asSdlRect[nSdlRectCnt].x = rRect.x;
+    asSdlRect[nSdlRectCnt].y = rRect.y;
+    asSdlRect[nSdlRectCnt].w = rRect.w;
+    asSdlRect[nSdlRectCnt].h = rRect.h;
+    nSdlRectCnt++;
+  }
+  SDL_UpdateRects(pScreen,nSdlRectCnt,asSdlRect);
+}
+#endif // DRV_DISP_SDL1
+
 
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
@@ -752,7 +929,30 @@ bool gslc_DrvDrawFillRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
-  return false;
+  if ((rRect.w == 0) || (rRect.h == 0)) {
+    return true;
+  }
+  // Lock and map the color once for all four edges
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+  int16_t  nX0 = rRect.x;
+  int16_t  nY0 = rRect.y;
+  int16_t  nX1 = (int16_t)(rRect.x + rRect.w - 1);
+  int16_t  nY1 = (int16_t)(rRect.y + rRect.h - 1);
+  gslc_DrvDrawSpanHRaw(pGui,nX0,nY0,rRect.w,nColRaw);       // Top
+  if (rRect.h > 1) {
+    gslc_DrvDrawSpanHRaw(pGui,nX0,nY1,rRect.w,nColRaw);     // Bottom
+  }
+  if (rRect.h > 2) {
+    gslc_DrvDrawSpanVRaw(pGui,nX0,nY0+1,rRect.h-2,nColRaw); // Left
+    if (rRect.w > 1) {
+      gslc_DrvDrawSpanVRaw(pGui,nX1,nY0+1,rRect.h-2,nColRaw); // Right
+    }
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -771,8 +971,59 @@ bool gslc_DrvDrawFrameRect(gslc_tsGui* pGui,gslc_tsRect rRect,gslc_tsColor nCol)
 bool gslc_DrvDrawLine(gslc_tsGui* pGui,int16_t nX0,int16_t nY0,int16_t nX1,int16_t nY1,gslc_tsColor nCol)
 {
 #if defined(DRV_DISP_SDL1)
-  // ERROR
-  return false;
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Rect*      pClip   = &pScreen->clip_rect;
+  int16_t        nCX0    = pClip->x;
+  int16_t        nCY0    = pClip->y;
+  int16_t        nCX1    = pClip->x + pClip->w - 1;
+  int16_t        nCY1    = pClip->y + pClip->h - 1;
+
+  // Trivially reject lines whose bounding box misses the clip region
+  if ( ((nX0 < nCX0) && (nX1 < nCX0)) || ((nX0 > nCX1) && (nX1 > nCX1)) ||
+       ((nY0 < nCY0) && (nY1 < nCY0)) || ((nY0 > nCY1) && (nY1 > nCY1)) ) {
+    return true;
+  }
+
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint32_t nColRaw = gslc_DrvAdaptColorRaw(pGui,nCol);
+
+  if (nY0 == nY1) {
+    // Horizontal line
+    gslc_DrvDrawSpanHRaw(pGui,(nX0<nX1)?nX0:nX1,nY0,(uint16_t)(abs(nX1-nX0)+1),nColRaw);
+  } else if (nX0 == nX1) {
+    // Vertical line
+    gslc_DrvDrawSpanVRaw(pGui,nX0,(nY0<nY1)?nY0:nY1,(uint16_t)(abs(nY1-nY0)+1),nColRaw);
+  } else {
+    // Perform Bresenham's line algorithm, writing directly to the surface
+    // - The line is not shortened to the clip region (eg. via gslc_ClipLine)
+    //   as that would shift the rasterized pixels slightly, leaving seams
+    //   when only part of a line is redrawn within a smaller clip rect.
+    //   Instead each pixel is range-checked inline.
+    uint8_t  nBpp   = pScreen->format->BytesPerPixel;
+    int32_t  nPitch = pScreen->pitch;
+    int16_t  nDX    = abs(nX1-nX0);
+    int16_t  nDY    = abs(nY1-nY0);
+    int16_t  nSX    = (nX0 < nX1)? 1 : -1;
+    int16_t  nSY    = (nY0 < nY1)? 1 : -1;
+    int16_t  nErr   = ( (nDX>nDY)? nDX : -nDY )/2;
+    int16_t  nE2;
+    uint8_t* pPixels = (uint8_t*)pScreen->pixels;
+    for (;;) {
+      if ( (nX0 >= nCX0) && (nX0 <= nCX1) && (nY0 >= nCY0) && (nY0 <= nCY1) ) {
+        gslc_DrvStorePixelRaw(pPixels + (int32_t)nY0 * nPitch + nX0 * nBpp,nBpp,nColRaw);
+      }
+      if ( (nX0 == nX1) && (nY0 == nY1) ) break;
+      nE2 = nErr;
+      if (nE2 > -nDX) { nErr -= nDY; nX0 += nSX; }
+      if (nE2 <  nDY) { nErr += nDX; nY0 += nSY; }
+    }
+  }
+
+  gslc_DrvScreenUnlock(pGui);
+  return true;
 #endif
 #if defined(DRV_DISP_SDL2)
   gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
@@ -874,6 +1125,100 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
 }
 
 
+#if defined(DRV_DISP_SDL1)
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pScreen->w) || (rRect.y + rRect.h > pScreen->h)) {
+    return false;
+  }
+  uint32_t nRowBytes = (uint32_t)rRect.w * pScreen->format->BytesPerPixel;
+  if ((uint32_t)rRect.h * nRowBytes > nBufSize) {
+    return false;
+  }
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint8_t* pDst = (uint8_t*)pvBuf;
+  const uint8_t* pSrc = (const uint8_t*)pScreen->pixels + rRect.y*pScreen->pitch + rRect.x*pScreen->format->BytesPerPixel;
+  for (uint16_t nRow=0;nRow<rRect.h;nRow++) {
+    memcpy(pDst,pSrc,nRowBytes);
+    pDst += nRowBytes;
+    pSrc += pScreen->pitch;
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+}
+
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pScreen->w) || (rRect.y + rRect.h > pScreen->h)) {
+    return false;
+  }
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+  uint32_t nRowBytes = (uint32_t)rRect.w * pScreen->format->BytesPerPixel;
+  const uint8_t* pSrc = (const uint8_t*)pvBuf;
+  uint8_t* pDst = (uint8_t*)pScreen->pixels + rRect.y*pScreen->pitch + rRect.x*pScreen->format->BytesPerPixel;
+  for (uint16_t nRow=0;nRow<rRect.h;nRow++) {
+    memcpy(pDst,pSrc,nRowBytes);
+    pDst += pScreen->pitch;
+    pSrc += nRowBytes;
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+}
+
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  if ((rSrc.x < 0) || (rSrc.y < 0) ||
+      (rSrc.x + rSrc.w > pScreen->w) || (rSrc.y + rSrc.h > pScreen->h)) {
+    return false;
+  }
+  if ((rSrc.w == 0) || (rSrc.h == 0)) { return true; }
+
+  // Clip the destination and trim the source to match
+  gslc_tsRect rScreen = (gslc_tsRect){0,0,(uint16_t)pScreen->w,(uint16_t)pScreen->h};
+  gslc_tsRect rDst = (gslc_tsRect){nDstX,nDstY,rSrc.w,rSrc.h};
+  if (!gslc_ClipRect(&(pDriver->rClipRect),&rDst)) { return true; }
+  if (!gslc_ClipRect(&rScreen,&rDst)) { return true; }
+  rSrc.x += rDst.x - nDstX;
+  rSrc.y += rDst.y - nDstY;
+  if (!gslc_DrvScreenLock(pGui)) {
+    return false;
+  }
+
+  // Walk the rows away from the overlap so that source rows
+  // are read before they are overwritten
+  uint8_t  nBpp = pScreen->format->BytesPerPixel;
+  uint32_t nRowBytes = (uint32_t)rDst.w * nBpp;
+  uint8_t* pSrc = (uint8_t*)pScreen->pixels + rSrc.y*pScreen->pitch + rSrc.x*nBpp;
+  uint8_t* pDst = (uint8_t*)pScreen->pixels + rDst.y*pScreen->pitch + rDst.x*nBpp;
+  int32_t  nStep = (int32_t)pScreen->pitch;
+  if (rDst.y > rSrc.y) {
+    pSrc += (rDst.h-1)*pScreen->pitch;
+    pDst += (rDst.h-1)*pScreen->pitch;
+    nStep = -nStep;
+  }
+  for (uint16_t nRow=0;nRow<rDst.h;nRow++) {
+    memmove(pDst,pSrc,nRowBytes);
+    pDst += nStep;
+    pSrc += nStep;
+  }
+  gslc_DrvScreenUnlock(pGui);
+  return true;
+}
+#endif // DRV_DISP_SDL1
+
+
 
 // ------------------------------------------------------------------------
 // Touch Functions (via SDL)
@@ -1350,32 +1695,73 @@ void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX, int16_t nY, uint32_t n
   // Here pPixel is the address to the pixel we want to set
   uint8_t *pPixel = (uint8_t *)pScreen->pixels + nY * pScreen->pitch + nX * nBpp;
 
+  gslc_DrvStorePixelRaw(pPixel,nBpp,nPixelVal);
+}
+
+void gslc_DrvDrawSpanHRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,uint32_t nPixelVal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Rect*      pClip   = &pScreen->clip_rect;
+
+  // Clip the span once rather than per pixel
+  int32_t nX0 = nX;
+  int32_t nX1 = (int32_t)nX + nW - 1;
+  if ( (nY < pClip->y) || (nY >= pClip->y + pClip->h) ) { return; }
+  if (nX0 < pClip->x)               { nX0 = pClip->x; }
+  if (nX1 >= pClip->x + pClip->w)   { nX1 = pClip->x + pClip->w - 1; }
+  if (nX0 > nX1)                    { return; }
+
+  uint8_t  nBpp   = pScreen->format->BytesPerPixel;
+  uint8_t* pPixel = (uint8_t*)pScreen->pixels + nY * pScreen->pitch + nX0 * nBpp;
+  int32_t  nCnt   = nX1 - nX0 + 1;
+
   switch(nBpp) {
     case 1:
-      *pPixel = nPixelVal;
+      memset(pPixel,(int)nPixelVal,nCnt);
       break;
-
     case 2:
-      *(uint16_t *)pPixel = nPixelVal;
-      break;
-
-    case 3:
-      if (SDL_BYTEORDER == SDL_BIG_ENDIAN) {
-        pPixel[0] = (nPixelVal >> 16) & 0xff;
-        pPixel[1] = (nPixelVal >> 8) & 0xff;
-        pPixel[2] = nPixelVal & 0xff;
-      } else {
-        pPixel[0] = nPixelVal & 0xff;
-        pPixel[1] = (nPixelVal >> 8) & 0xff;
-        pPixel[2] = (nPixelVal >> 16) & 0xff;
+      {
+        uint16_t* pPixel16 = (uint16_t*)pPixel;
+        while (nCnt--) { *pPixel16++ = (uint16_t)nPixelVal; }
       }
       break;
-
     case 4:
-      *(uint32_t *)pPixel = nPixelVal;
+      {
+        uint32_t* pPixel32 = (uint32_t*)pPixel;
+        while (nCnt--) { *pPixel32++ = nPixelVal; }
+      }
+      break;
+    default:
+      for (;nCnt>0;nCnt--,pPixel+=nBpp) {
+        gslc_DrvStorePixelRaw(pPixel,nBpp,nPixelVal);
+      }
       break;
   }
+}
 
+void gslc_DrvDrawSpanVRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,uint32_t nPixelVal)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  SDL_Surface*   pScreen = pDriver->pSurfScreen;
+  SDL_Rect*      pClip   = &pScreen->clip_rect;
+
+  // Clip the span once rather than per pixel
+  int32_t nY0 = nY;
+  int32_t nY1 = (int32_t)nY + nH - 1;
+  if ( (nX < pClip->x) || (nX >= pClip->x + pClip->w) ) { return; }
+  if (nY0 < pClip->y)               { nY0 = pClip->y; }
+  if (nY1 >= pClip->y + pClip->h)   { nY1 = pClip->y + pClip->h - 1; }
+  if (nY0 > nY1)                    { return; }
+
+  uint8_t  nBpp   = pScreen->format->BytesPerPixel;
+  int32_t  nPitch = pScreen->pitch;
+  uint8_t* pPixel = (uint8_t*)pScreen->pixels + nY0 * nPitch + nX * nBpp;
+  int32_t  nCnt;
+
+  for (nCnt=nY1-nY0+1;nCnt>0;nCnt--,pPixel+=nPitch) {
+    gslc_DrvStorePixelRaw(pPixel,nBpp,nPixelVal);
+  }
 }
 
 void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc, void* pvDest)
@@ -1395,6 +1781,367 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
 #endif
 
 
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+// -----------------------------------------------------------------------
+// Rendered Text Cache Functions (SDL2)
+// -----------------------------------------------------------------------
+
+// FNV-1a hash of a string
+static uint32_t gslc_DrvTxtCacheHash(const char* pStr)
+{
+  uint32_t nHash = 2166136261u;
+  while (*pStr) {
+    nHash ^= (uint8_t)(*pStr++);
+    nHash *= 16777619u;
+  }
+  return nHash;
+}
+
+// Release a single cache entry
+static void gslc_DrvTxtCacheRelease(gslc_tsDriver* pDriver,gslc_tsDrvTxtCache* pEntry)
+{
+  if (pEntry->pTex == NULL) {
+    return;
+  }
+  SDL_DestroyTexture(pEntry->pTex);
+  free(pEntry->pStr);
+  pDriver->nTxtCacheBytes -= (uint32_t)pEntry->nW * pEntry->nH * 4;
+  memset(pEntry,0,sizeof(gslc_tsDrvTxtCache));
+}
+
+SDL_Texture* gslc_DrvTxtCacheFind(gslc_tsGui* pGui,const void* pvFont,gslc_teTxtFlags eTxtFlags,
+  gslc_tsColor colTxt,const char* pStr,uint16_t* pnW,uint16_t* pnH)
+{
+  gslc_tsDriver*      pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvTxtCache* pEntry;
+  uint32_t            nHash   = gslc_DrvTxtCacheHash(pStr);
+  uint8_t             nEnc    = (uint8_t)(eTxtFlags & GSLC_TXT_ENC);
+  uint16_t            nInd;
+
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+    pEntry = &(pDriver->asTxtCache[nInd]);
+    if ((pEntry->pTex == NULL) || (pEntry->nHash != nHash)) { continue; }
+    if ((pEntry->pvFont != pvFont) || (pEntry->nEnc != nEnc)) { continue; }
+    if ((pEntry->colTxt.r != colTxt.r) || (pEntry->colTxt.g != colTxt.g) || (pEntry->colTxt.b != colTxt.b)) { continue; }
+    if (strcmp(pEntry->pStr,pStr) != 0) { continue; }
+    // Found
+    pEntry->nLastUse = ++pDriver->nTxtCacheTick;
+    pDriver->nTxtCacheHit++;
+    *pnW = pEntry->nW;
+    *pnH = pEntry->nH;
+    return pEntry->pTex;
+  }
+  pDriver->nTxtCacheMiss++;
+  return NULL;
+}
+
+bool gslc_DrvTxtCacheAdd(gslc_tsGui* pGui,const void* pvFont,gslc_teTxtFlags eTxtFlags,
+  gslc_tsColor colTxt,const char* pStr,SDL_Texture* pTex,uint16_t nW,uint16_t nH)
+{
+  gslc_tsDriver*      pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvTxtCache* pEntry  = NULL;
+  gslc_tsDrvTxtCache* pOldest;
+  uint32_t            nBytes  = (uint32_t)nW * nH * 4;
+  uint16_t            nInd;
+
+  // Textures that would exceed the entire budget are not retained
+  if (nBytes > DRV_SDL_TXT_CACHE_MEM) {
+    return false;
+  }
+
+  // Evict the least-recently-used entries until there is
+  // a free slot and the memory limit is satisfied
+  while (1) {
+    pEntry  = NULL;
+    pOldest = NULL;
+    for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+      gslc_tsDrvTxtCache* pCur = &(pDriver->asTxtCache[nInd]);
+      if (pCur->pTex == NULL) {
+        if (pEntry == NULL) { pEntry = pCur; }
+      } else if ((pOldest == NULL) || (pCur->nLastUse < pOldest->nLastUse)) {
+        pOldest = pCur;
+      }
+    }
+    if ((pEntry != NULL) && (pDriver->nTxtCacheBytes + nBytes <= DRV_SDL_TXT_CACHE_MEM)) {
+      break;
+    }
+    if (pOldest == NULL) {
+      return false;
+    }
+    gslc_DrvTxtCacheRelease(pDriver,pOldest);
+  }
+
+  pEntry->pStr = strdup(pStr);
+  if (pEntry->pStr == NULL) {
+    return false;
+  }
+  pEntry->pTex      = pTex;
+  pEntry->pvFont    = pvFont;
+  pEntry->colTxt    = colTxt;
+  pEntry->nEnc      = (uint8_t)(eTxtFlags & GSLC_TXT_ENC);
+  pEntry->nHash     = gslc_DrvTxtCacheHash(pStr);
+  pEntry->nW        = nW;
+  pEntry->nH        = nH;
+  pEntry->nLastUse  = ++pDriver->nTxtCacheTick;
+  pDriver->nTxtCacheBytes += nBytes;
+  return true;
+}
+
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t       nInd;
+  for (nInd=0;nInd<DRV_SDL_TXT_CACHE_MAX;nInd++) {
+    gslc_DrvTxtCacheRelease(pDriver,&(pDriver->asTxtCache[nInd]));
+  }
+  pDriver->nTxtCacheBytes = 0;
+}
+
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnBytes)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  *pnHit   = pDriver->nTxtCacheHit;
+  *pnMiss  = pDriver->nTxtCacheMiss;
+  *pnBytes = pDriver->nTxtCacheBytes;
+}
+
+#endif // DRV_DISP_SDL2 && DRV_SDL_TXT_CACHE_MAX
+
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+// -----------------------------------------------------------------------
+// Glyph Atlas Functions
+// -----------------------------------------------------------------------
+
+// Maximum width of a glyph atlas before wrapping to a new row
+#define DRV_SDL_GLYPH_ATLAS_W 1024
+
+// Release a single glyph atlas
+static void gslc_DrvGlyphAtlasRelease(gslc_tsDrvGlyphAtlas* pAtlas)
+{
+  #if defined(DRV_DISP_SDL1)
+  if (pAtlas->pSurf != NULL) {
+    SDL_FreeSurface(pAtlas->pSurf);
+  }
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  if (pAtlas->pTex != NULL) {
+    SDL_DestroyTexture(pAtlas->pTex);
+  }
+  #endif
+  memset(pAtlas,0,sizeof(gslc_tsDrvGlyphAtlas));
+}
+
+// Render the glyphs of a font into an atlas
+// - Each glyph is rendered individually by SDL_ttf and then
+//   copied (including its alpha channel) into the atlas surface
+static bool gslc_DrvGlyphAtlasBuild(gslc_tsGui* pGui,gslc_tsDrvGlyphAtlas* pAtlas,TTF_Font* pDrvFont,gslc_tsColor colTxt)
+{
+  SDL_Surface*  apSurfGlyph[DRV_SDL_GLYPH_LAST-DRV_SDL_GLYPH_FIRST+1];
+  SDL_Surface*  pSurfAtlas  = NULL;
+  SDL_Surface*  pSurfFmt    = NULL;
+  SDL_Color     colRender;
+  char          acGlyph[2];
+  int16_t       nX = 0;
+  int16_t       nY = 0;
+  int16_t       nAtlasW = 0;
+  uint16_t      nH = (uint16_t)TTF_FontHeight(pDrvFont);
+  int           nMinX,nMaxX,nMinY,nMaxY,nAdvance;
+  uint16_t      nInd;
+  bool          bOk = true;
+
+  #if defined(DRV_DISP_SDL1)
+  colRender = gslc_DrvAdaptColor(colTxt);
+  #else
+  // Glyphs are rendered in white and colored with texture color modulation
+  (void)colTxt;
+  colRender = gslc_DrvAdaptColor(GSLC_COL_WHITE);
+  #endif
+
+  // Render each glyph and assign its location in the atlas
+  acGlyph[1] = '\0';
+  for (nInd=0;nInd<=DRV_SDL_GLYPH_LAST-DRV_SDL_GLYPH_FIRST;nInd++) {
+    gslc_tsDrvGlyph* pGlyph = &(pAtlas->asGlyph[nInd]);
+    acGlyph[0] = (char)(DRV_SDL_GLYPH_FIRST+nInd);
+    apSurfGlyph[nInd] = NULL;
+    if (TTF_GlyphMetrics(pDrvFont,(Uint16)acGlyph[0],&nMinX,&nMaxX,&nMinY,&nMaxY,&nAdvance) != 0) {
+      // Glyph not provided by font
+      continue;
+    }
+    pGlyph->nAdvance = (int16_t)nAdvance;
+    // SDL_ttf starts the rendered glyph at the pen position
+    // unless it extends to the left of it
+    pGlyph->nOffsetX = (nMinX < 0)? (int16_t)nMinX : 0;
+    apSurfGlyph[nInd] = TTF_RenderText_Blended(pDrvFont,acGlyph,colRender);
+    if (apSurfGlyph[nInd] == NULL) {
+      continue;
+    }
+    if (pSurfFmt == NULL) {
+      pSurfFmt = apSurfGlyph[nInd];
+    }
+    if (nX + apSurfGlyph[nInd]->w > DRV_SDL_GLYPH_ATLAS_W) {
+      nX  = 0;
+      nY += nH;
+    }
+    pGlyph->nX = nX;
+    pGlyph->nY = nY;
+    pGlyph->nW = (uint16_t)apSurfGlyph[nInd]->w;
+    nX += apSurfGlyph[nInd]->w;
+    if (nX > nAtlasW) { nAtlasW = nX; }
+  }
+
+  if (pSurfFmt == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGlyphAtlasBuild() failed to render glyphs (%s)\n",TTF_GetError());
+    bOk = false;
+  }
+
+  // Copy the glyphs into the atlas
+  if (bOk) {
+    SDL_PixelFormat* pFmt = pSurfFmt->format;
+    pSurfAtlas = SDL_CreateRGBSurface(SDL_SWSURFACE,nAtlasW,nY+nH,pFmt->BitsPerPixel,
+      pFmt->Rmask,pFmt->Gmask,pFmt->Bmask,pFmt->Amask);
+    if (pSurfAtlas == NULL) {
+      GSLC_DEBUG2_PRINT("ERROR: DrvGlyphAtlasBuild() failed in SDL_CreateRGBSurface(): %s\n",SDL_GetError());
+      bOk = false;
+    }
+  }
+  for (nInd=0;nInd<=DRV_SDL_GLYPH_LAST-DRV_SDL_GLYPH_FIRST;nInd++) {
+    if (apSurfGlyph[nInd] == NULL) {
+      continue;
+    }
+    if (bOk) {
+      SDL_Rect rDst = (SDL_Rect){pAtlas->asGlyph[nInd].nX,pAtlas->asGlyph[nInd].nY,0,0};
+      // Copy the pixels rather than blending them
+      #if defined(DRV_DISP_SDL1)
+      SDL_SetAlpha(apSurfGlyph[nInd],0,SDL_ALPHA_OPAQUE);
+      #else
+      SDL_SetSurfaceBlendMode(apSurfGlyph[nInd],SDL_BLENDMODE_NONE);
+      #endif
+      SDL_BlitSurface(apSurfGlyph[nInd],NULL,pSurfAtlas,&rDst);
+    }
+    SDL_FreeSurface(apSurfGlyph[nInd]);
+  }
+  if (!bOk) {
+    return false;
+  }
+
+  #if defined(DRV_DISP_SDL1)
+  SDL_SetAlpha(pSurfAtlas,SDL_SRCALPHA,SDL_ALPHA_OPAQUE);
+  pAtlas->pSurf   = pSurfAtlas;
+  pAtlas->colTxt  = colTxt;
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  pAtlas->pTex = SDL_CreateTextureFromSurface(pDriver->pRender,pSurfAtlas);
+  SDL_FreeSurface(pSurfAtlas);
+  if (pAtlas->pTex == NULL) {
+    GSLC_DEBUG2_PRINT("ERROR: DrvGlyphAtlasBuild() error in SDL_CreateTextureFromSurface(): %s\n",SDL_GetError());
+    return false;
+  }
+  SDL_SetTextureBlendMode(pAtlas->pTex,SDL_BLENDMODE_BLEND);
+  #endif
+  (void)pGui;
+  pAtlas->pvFont  = pDrvFont;
+  pAtlas->nH      = nH;
+  return true;
+}
+
+// Find the glyph atlas for a font, creating it if necessary
+static gslc_tsDrvGlyphAtlas* gslc_DrvGlyphAtlasGet(gslc_tsGui* pGui,TTF_Font* pDrvFont,gslc_tsColor colTxt)
+{
+  gslc_tsDriver*        pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvGlyphAtlas* pAtlas;
+  gslc_tsDrvGlyphAtlas* pFree   = NULL;
+  gslc_tsDrvGlyphAtlas* pOldest = NULL;
+  bool                  bMatch;
+  uint16_t              nInd;
+
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_MAX;nInd++) {
+    pAtlas = &(pDriver->asGlyphAtlas[nInd]);
+    if (pAtlas->pvFont == NULL) {
+      if (pFree == NULL) { pFree = pAtlas; }
+      continue;
+    }
+    bMatch = (pAtlas->pvFont == pDrvFont);
+    #if defined(DRV_DISP_SDL1)
+    bMatch = bMatch && (pAtlas->colTxt.r == colTxt.r) && (pAtlas->colTxt.g == colTxt.g) && (pAtlas->colTxt.b == colTxt.b);
+    #endif
+    if (bMatch) {
+      // Found
+      pAtlas->nLastUse = ++pDriver->nGlyphAtlasTick;
+      return pAtlas;
+    }
+    if ((pOldest == NULL) || (pAtlas->nLastUse < pOldest->nLastUse)) {
+      pOldest = pAtlas;
+    }
+  }
+
+  // Build a new atlas in an unused slot, otherwise
+  // replace the least-recently-used atlas
+  pAtlas = (pFree != NULL)? pFree : pOldest;
+  gslc_DrvGlyphAtlasRelease(pAtlas);
+  if (!gslc_DrvGlyphAtlasBuild(pGui,pAtlas,pDrvFont,colTxt)) {
+    gslc_DrvGlyphAtlasRelease(pAtlas);
+    return NULL;
+  }
+  pAtlas->nLastUse = ++pDriver->nGlyphAtlasTick;
+  return pAtlas;
+}
+
+bool gslc_DrvGlyphAtlasDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,const void* pvFont,
+  const char* pStr,gslc_tsColor colTxt)
+{
+  gslc_tsDriver*        pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  gslc_tsDrvGlyphAtlas* pAtlas;
+  const char*           pChar;
+  int16_t               nPenX = nTxtX;
+
+  // Only strings made up entirely of atlas characters are supported
+  // - This also excludes multi-byte UTF-8 sequences
+  for (pChar=pStr;*pChar != '\0';pChar++) {
+    uint8_t nChar = (uint8_t)(*pChar);
+    if ((nChar < DRV_SDL_GLYPH_FIRST) || (nChar > DRV_SDL_GLYPH_LAST)) {
+      return false;
+    }
+  }
+
+  pAtlas = gslc_DrvGlyphAtlasGet(pGui,(TTF_Font*)pvFont,colTxt);
+  if (pAtlas == NULL) {
+    return false;
+  }
+
+  #if defined(DRV_DISP_SDL2)
+  SDL_SetTextureColorMod(pAtlas->pTex,colTxt.r,colTxt.g,colTxt.b);
+  #endif
+  for (pChar=pStr;*pChar != '\0';pChar++) {
+    gslc_tsDrvGlyph* pGlyph = &(pAtlas->asGlyph[(uint8_t)(*pChar)-DRV_SDL_GLYPH_FIRST]);
+    if (pGlyph->nW > 0) {
+      SDL_Rect rSrc = (SDL_Rect){pGlyph->nX,pGlyph->nY,pGlyph->nW,pAtlas->nH};
+      SDL_Rect rDst = (SDL_Rect){nPenX+pGlyph->nOffsetX,nTxtY,pGlyph->nW,pAtlas->nH};
+      #if defined(DRV_DISP_SDL1)
+      SDL_BlitSurface(pAtlas->pSurf,&rSrc,pDriver->pSurfScreen,&rDst);
+      #endif
+      #if defined(DRV_DISP_SDL2)
+      SDL_RenderCopy(pDriver->pRender,pAtlas->pTex,&rSrc,&rDst);
+      #endif
+    }
+    nPenX += pGlyph->nAdvance;
+  }
+  return true;
+}
+
+void gslc_DrvGlyphAtlasFlush(gslc_tsGui* pGui)
+{
+  gslc_tsDriver* pDriver = (gslc_tsDriver*)(pGui->pvDriver);
+  uint16_t       nInd;
+  for (nInd=0;nInd<DRV_SDL_GLYPH_ATLAS_MAX;nInd++) {
+    gslc_DrvGlyphAtlasRelease(&(pDriver->asGlyphAtlas[nInd]));
+  }
+}
+
+#endif // DRV_SDL_GLYPH_ATLAS_MAX
+
+
 
 // ------------------------------------------------------------------------
 // Touch Functions (via external tslib)
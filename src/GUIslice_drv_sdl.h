@@ -62,6 +62,40 @@ extern "C" {
   #include "tslib.h"
 #endif
 
+// Render SDL2 output into a persistent target texture
+// - The texture retains its contents across SDL_RenderPresent()
+//   which enables partial redraw. If render targets are not
+//   supported by the renderer, full page redraws are used instead.
+#if defined(DRV_DISP_SDL2) && !defined(DRV_SDL_RENDER_TARGET)
+  #define DRV_SDL_RENDER_TARGET 1
+#endif
+
+// Cache of rendered text textures (SDL2)
+// - DRV_SDL_TXT_CACHE_MAX: Maximum number of cached strings (0 to disable)
+// - DRV_SDL_TXT_CACHE_MEM: Maximum texture memory (bytes) retained by the cache
+// - The least-recently-used entries are released when either limit is reached
+#if defined(DRV_DISP_SDL2) && !defined(DRV_SDL_TXT_CACHE_MAX)
+  #define DRV_SDL_TXT_CACHE_MAX 128
+#endif
+#if defined(DRV_DISP_SDL2) && !defined(DRV_SDL_TXT_CACHE_MEM)
+  #define DRV_SDL_TXT_CACHE_MEM (4*1024*1024)
+#endif
+
+// Glyph atlas text rendering
+// - DRV_SDL_GLYPH_ATLAS_MAX: Maximum number of glyph atlases (0 to disable)
+// - On first use, the printable ASCII glyphs of a font are rendered
+//   into a single atlas. Strings consisting only of these characters
+//   are then drawn as a series of glyph blits instead of being
+//   rendered by SDL_ttf. Other strings use the normal rendering path.
+// - SDL2 uses one atlas per font and applies the text color with
+//   texture color modulation. SDL1 uses one atlas per font and color.
+// - The least-recently-used atlas is released when the limit is reached
+// - Glyphs are placed by their advance width, so font kerning pairs
+//   are not applied
+#if !defined(DRV_SDL_GLYPH_ATLAS_MAX)
+  #define DRV_SDL_GLYPH_ATLAS_MAX 0
+#endif
+
 // =======================================================================
 // API support definitions
 // - These defines indicate whether the driver includes optimized
@@ -75,8 +109,8 @@ extern "C" {
 
 #if defined(DRV_DISP_SDL1)
   #define DRV_HAS_DRAW_POINTS            1 ///< Support gslc_DrvDrawPoints()
-  #define DRV_HAS_DRAW_LINE              0 ///< Support gslc_DrvDrawLine()
-  #define DRV_HAS_DRAW_RECT_FRAME        0 ///< Support gslc_DrvDrawFrameRect()
+  #define DRV_HAS_DRAW_LINE              1 ///< Support gslc_DrvDrawLine()
+  #define DRV_HAS_DRAW_RECT_FRAME        1 ///< Support gslc_DrvDrawFrameRect()
   #define DRV_HAS_DRAW_RECT_FILL         1 ///< Support gslc_DrvDrawFillRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FRAME  0 ///< Support gslc_DrvDrawFrameRoundRect()
   #define DRV_HAS_DRAW_RECT_ROUND_FILL   0 ///< Support gslc_DrvDrawFillRoundRect()
@@ -86,6 +120,9 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_SAVE_RECT              1 ///< Support gslc_DrvSaveRect() and gslc_DrvRestoreRect()
+  #define DRV_HAS_FLIP_RECTS             1 ///< Support gslc_DrvPageFlipRects()
+  #define DRV_HAS_COPY_RECT              1 ///< Support gslc_DrvCopyRect()
 #endif
 
 #if defined(DRV_DISP_SDL2)
@@ -101,6 +138,9 @@ extern "C" {
   #define DRV_HAS_DRAW_TRI_FILL          0 ///< Support gslc_DrvDrawFillTriangle()
   #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
   #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+  #define DRV_HAS_SAVE_RECT              0 ///< Support gslc_DrvSaveRect() and gslc_DrvRestoreRect()
+  #define DRV_HAS_FLIP_RECTS             0 ///< Support gslc_DrvPageFlipRects()
+  #define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
 #endif
 
 #define DRV_OVERRIDE_TXT_ALIGN      0 ///< Driver provides text alignment
@@ -108,6 +148,51 @@ extern "C" {
 // =======================================================================
 // Driver-specific members
 // =======================================================================
+
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+/// Rendered text texture cache entry
+typedef struct {
+  SDL_Texture*        pTex;             ///< Rendered text texture (NULL if entry unused)
+  const void*         pvFont;           ///< Font used for rendering
+  gslc_tsColor        colTxt;           ///< Text color
+  uint8_t             nEnc;             ///< Text encoding (GSLC_TXT_ENC_*)
+  uint32_t            nHash;            ///< Hash of the string
+  char*               pStr;             ///< Copy of the string
+  uint16_t            nW;               ///< Texture width
+  uint16_t            nH;               ///< Texture height
+  uint32_t            nLastUse;         ///< Tick of most recent use (for LRU)
+} gslc_tsDrvTxtCache;
+#endif
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+#define DRV_SDL_GLYPH_FIRST   32        ///< First character in glyph atlas
+#define DRV_SDL_GLYPH_LAST    126       ///< Last character in glyph atlas
+
+/// Glyph location within a glyph atlas
+typedef struct {
+  int16_t             nX;               ///< X coordinate of glyph in atlas
+  int16_t             nY;               ///< Y coordinate of glyph in atlas
+  uint16_t            nW;               ///< Width of glyph in atlas (0 if none)
+  int16_t             nOffsetX;         ///< X offset of glyph from pen position
+  int16_t             nAdvance;         ///< Pen advance after glyph
+} gslc_tsDrvGlyph;
+
+/// Glyph atlas for a font
+typedef struct {
+  const void*         pvFont;           ///< Font used for rendering (NULL if atlas unused)
+  #if defined(DRV_DISP_SDL1)
+  SDL_Surface*        pSurf;            ///< Atlas surface (rendered in colTxt)
+  gslc_tsColor        colTxt;           ///< Text color
+  #endif
+  #if defined(DRV_DISP_SDL2)
+  SDL_Texture*        pTex;             ///< Atlas texture (rendered in white)
+  #endif
+  uint16_t            nH;               ///< Height of glyphs
+  uint32_t            nLastUse;         ///< Tick of most recent use (for LRU)
+  gslc_tsDrvGlyph     asGlyph[DRV_SDL_GLYPH_LAST-DRV_SDL_GLYPH_FIRST+1]; ///< Glyph locations
+} gslc_tsDrvGlyphAtlas;
+#endif
+
 typedef struct {
 
   #if defined(DRV_DISP_SDL1)
@@ -117,6 +202,20 @@ typedef struct {
   #if defined(DRV_DISP_SDL2)
   SDL_Window*         pWind;            ///< SDL2 Window
   SDL_Renderer*       pRender;          ///< SDL2 Rendering engine
+  SDL_Texture*        pTexTarget;       ///< SDL2 persistent render target (NULL if unused)
+  #endif
+
+  #if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+  gslc_tsDrvTxtCache  asTxtCache[DRV_SDL_TXT_CACHE_MAX]; ///< Rendered text cache
+  uint32_t            nTxtCacheBytes;   ///< Texture memory retained by the cache
+  uint32_t            nTxtCacheTick;    ///< LRU counter
+  uint32_t            nTxtCacheHit;     ///< Number of cache hits
+  uint32_t            nTxtCacheMiss;    ///< Number of cache misses
+  #endif
+
+  #if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+  gslc_tsDrvGlyphAtlas asGlyphAtlas[DRV_SDL_GLYPH_ATLAS_MAX]; ///< Glyph atlases
+  uint32_t            nGlyphAtlasTick;  ///< LRU counter
   #endif
 
   #if defined(DRV_TOUCH_TSLIB)
@@ -145,6 +244,7 @@ typedef struct {
 /// Initialize the SDL library
 /// - Performs clean startup workaround (if enabled)
 /// - Configures video mode
+/// - Creates the SDL2 render target texture (if DRV_SDL_RENDER_TARGET)
 /// - Initializes font support
 ///
 /// PRE:
@@ -378,6 +478,22 @@ bool gslc_DrvDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,gslc_tsFont* p
 void gslc_DrvPageFlipNow(gslc_tsGui* pGui);
 
 
+#if defined(DRV_DISP_SDL1)
+///
+/// Copy only the given regions of the screen surface to the display
+/// - Used instead of gslc_DrvPageFlipNow() when a redraw has been
+///   limited to a set of invalidated regions
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  asRect:      Array of regions to update
+/// \param[in]  nRectCnt:    Number of entries in asRect
+///
+/// \return none
+///
+void gslc_DrvPageFlipRects(gslc_tsGui* pGui,gslc_tsRect* asRect,uint8_t nRectCnt);
+#endif // DRV_DISP_SDL1
+
+
 // -----------------------------------------------------------------------
 // Graphics Primitives Functions
 // -----------------------------------------------------------------------
@@ -478,6 +594,49 @@ bool gslc_DrvDrawImage(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_tsImgRe
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
 
 
+#if defined(DRV_DISP_SDL1)
+///
+/// Copy a region of the display into a buffer
+/// - The buffer holds the screen surface bytes per pixel
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region to save (must be on-screen)
+/// \param[out] pvBuf:       Buffer to receive the pixel data
+/// \param[in]  nBufSize:    Size of pvBuf (in bytes)
+///
+/// \return true if success, false if the buffer is too small
+///
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize);
+
+
+///
+/// Copy a region saved by gslc_DrvSaveRect() back to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region that was saved
+/// \param[in]  pvBuf:       Buffer holding the pixel data
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf);
+
+
+///
+/// Copy a region of the display to another position on the display
+/// - Source and destination may overlap (eg. to scroll a region)
+/// - The destination is clipped to the current clip region
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rSrc:        Display region to copy (must be on-screen)
+/// \param[in]  nDstX:       Destination X coordinate of the copy
+/// \param[in]  nDstY:       Destination Y coordinate of the copy
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvCopyRect(gslc_tsGui* pGui,gslc_tsRect rSrc,int16_t nDstX,int16_t nDstY);
+#endif // DRV_DISP_SDL1
+
+
 // -----------------------------------------------------------------------
 // Touch Functions
 // -----------------------------------------------------------------------
@@ -650,6 +809,42 @@ uint32_t gslc_DrvDrawGetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY);
 ///
 void gslc_DrvDrawSetPixelRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint32_t nPixelCol);
 
+///
+/// Draw a horizontal span of pixels on the active screen
+/// - The span is clipped once against the surface clip rect
+///   and then written directly into the pixel buffer
+///
+/// PRE:
+/// - Screen surface must be locked
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          Leftmost X coordinate of span
+/// \param[in]  nY:          Y coordinate of span
+/// \param[in]  nW:          Span width in pixels
+/// \param[in]  nPixelCol:   Raw color pixel value to assign
+///
+/// \return none
+///
+void gslc_DrvDrawSpanHRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nW,uint32_t nPixelCol);
+
+///
+/// Draw a vertical span of pixels on the active screen
+/// - The span is clipped once against the surface clip rect
+///   and then written directly into the pixel buffer
+///
+/// PRE:
+/// - Screen surface must be locked
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nX:          X coordinate of span
+/// \param[in]  nY:          Topmost Y coordinate of span
+/// \param[in]  nH:          Span height in pixels
+/// \param[in]  nPixelCol:   Raw color pixel value to assign
+///
+/// \return none
+///
+void gslc_DrvDrawSpanVRaw(gslc_tsGui* pGui,int16_t nX,int16_t nY,uint16_t nH,uint32_t nPixelCol);
+
 ///
 /// Copy one image region to another.
 /// - This is typically used to copy an image to the main screen surface
@@ -667,6 +862,107 @@ void gslc_DrvPasteSurface(gslc_tsGui* pGui,int16_t nX, int16_t nY, void* pvSrc,
 #endif // DRV_DISP_SDL1
 
 
+#if defined(DRV_DISP_SDL2) && (DRV_SDL_TXT_CACHE_MAX > 0)
+// -----------------------------------------------------------------------
+// Rendered Text Cache Functions (SDL2)
+// -----------------------------------------------------------------------
+
+///
+/// Look up a previously rendered text string
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvFont:      Font used for rendering
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Text color
+/// \param[in]  pStr:        String to find
+/// \param[out] pnW:         Ptr to width of texture
+/// \param[out] pnH:         Ptr to height of texture
+///
+/// \return Texture if found, NULL otherwise
+///
+SDL_Texture* gslc_DrvTxtCacheFind(gslc_tsGui* pGui,const void* pvFont,gslc_teTxtFlags eTxtFlags,
+  gslc_tsColor colTxt,const char* pStr,uint16_t* pnW,uint16_t* pnH);
+
+///
+/// Add a rendered text texture to the cache
+/// - Least-recently-used entries are released to satisfy
+///   DRV_SDL_TXT_CACHE_MAX and DRV_SDL_TXT_CACHE_MEM
+/// - On success the cache takes ownership of the texture
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pvFont:      Font used for rendering
+/// \param[in]  eTxtFlags:   Flags associated with text string
+/// \param[in]  colTxt:      Text color
+/// \param[in]  pStr:        String that was rendered
+/// \param[in]  pTex:        Rendered texture
+/// \param[in]  nW:          Width of texture
+/// \param[in]  nH:          Height of texture
+///
+/// \return true if added, false if the texture was not cached
+///
+bool gslc_DrvTxtCacheAdd(gslc_tsGui* pGui,const void* pvFont,gslc_teTxtFlags eTxtFlags,
+  gslc_tsColor colTxt,const char* pStr,SDL_Texture* pTex,uint16_t nW,uint16_t nH);
+
+///
+/// Release all textures in the rendered text cache
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvTxtCacheFlush(gslc_tsGui* pGui);
+
+///
+/// Fetch the rendered text cache statistics
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[out] pnHit:       Ptr to number of cache hits
+/// \param[out] pnMiss:      Ptr to number of cache misses
+/// \param[out] pnBytes:     Ptr to texture memory retained by the cache
+///
+/// \return none
+///
+void gslc_DrvTxtCacheGetStats(gslc_tsGui* pGui,uint32_t* pnHit,uint32_t* pnMiss,uint32_t* pnBytes);
+
+#endif // DRV_DISP_SDL2 && DRV_SDL_TXT_CACHE_MAX
+
+
+#if (DRV_SDL_GLYPH_ATLAS_MAX > 0)
+// -----------------------------------------------------------------------
+// Glyph Atlas Functions
+// -----------------------------------------------------------------------
+
+///
+/// Draw a text string from a glyph atlas
+/// - The atlas for the font is created on first use
+/// - Only strings consisting of characters in the range
+///   DRV_SDL_GLYPH_FIRST..DRV_SDL_GLYPH_LAST are supported
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  nTxtX:       X coordinate of top-left text string
+/// \param[in]  nTxtY:       Y coordinate of top-left text string
+/// \param[in]  pvFont:      Font used for rendering
+/// \param[in]  pStr:        String to display
+/// \param[in]  colTxt:      Text color
+///
+/// \return true if the string was drawn, false if the string is not
+///         supported by the atlas and should be rendered normally
+///
+bool gslc_DrvGlyphAtlasDrawTxt(gslc_tsGui* pGui,int16_t nTxtX,int16_t nTxtY,const void* pvFont,
+  const char* pStr,gslc_tsColor colTxt);
+
+///
+/// Release all glyph atlases
+///
+/// \param[in]  pGui:        Pointer to GUI
+///
+/// \return none
+///
+void gslc_DrvGlyphAtlasFlush(gslc_tsGui* pGui);
+
+#endif // DRV_SDL_GLYPH_ATLAS_MAX
+
+
 
 // -----------------------------------------------------------------------
 // Private Touchscreen Functions (if using SDL)
@@ -318,7 +318,11 @@ bool gslc_DrvSetElemImageNorm(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefNorm = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,false,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
@@ -327,7 +331,11 @@ bool gslc_DrvSetElemImageGlow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsImgRef
 {
   // This driver doesn't preload the image to memory,
   // so we just save the reference for loading upon render
-  pElem->sImgRefGlow = sImgRef;
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,true,true);
+  if (pImgRef == NULL) {
+    return false;
+  }
+  *pImgRef = sImgRef;
   return true; // TODO
 }
 
@@ -1126,6 +1134,31 @@ void gslc_DrvDrawBkgnd(gslc_tsGui* pGui)
 }
 
 
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize)
+{
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pGui->nDispW) || (rRect.y + rRect.h > pGui->nDispH)) {
+    return false;
+  }
+  if ((uint32_t)rRect.w * rRect.h * sizeof(uint16_t) > nBufSize) {
+    return false;
+  }
+  // The readback format matches the format expected by pushRect()
+  m_disp.readRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)pvBuf);
+  return true;
+}
+
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf)
+{
+  if ((rRect.x < 0) || (rRect.y < 0) ||
+      (rRect.x + rRect.w > pGui->nDispW) || (rRect.y + rRect.h > pGui->nDispH)) {
+    return false;
+  }
+  m_disp.pushRect(rRect.x,rRect.y,rRect.w,rRect.h,(uint16_t*)pvBuf);
+  return true;
+}
+
+
 // -----------------------------------------------------------------------
 // Touch Functions (via display driver)
 // -----------------------------------------------------------------------
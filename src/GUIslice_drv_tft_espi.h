@@ -137,6 +137,9 @@ extern "C" {
 #define DRV_HAS_DRAW_TRI_FILL          1 ///< Support gslc_DrvDrawFillTriangle()
 #define DRV_HAS_DRAW_TEXT              1 ///< Support gslc_DrvDrawTxt()
 #define DRV_HAS_DRAW_BMP_MEM           0 ///< Support gslc_DrvDrawBmp24FromMem()
+#define DRV_HAS_SAVE_RECT              1 ///< Support gslc_DrvSaveRect() and gslc_DrvRestoreRect()
+#define DRV_HAS_FLIP_RECTS             0 ///< Support gslc_DrvPageFlipRects()
+#define DRV_HAS_COPY_RECT              0 ///< Support gslc_DrvCopyRect()
 
 #define DRV_OVERRIDE_TXT_ALIGN         1 ///< Driver provides text alignment
 
@@ -678,6 +681,33 @@ bool gslc_DrvDrawJpegFromFile(gslc_tsGui* pGui,int16_t nDstX,int16_t nDstY,gslc_
 void gslc_DrvDrawBkgnd(gslc_tsGui* pGui);
 
 
+///
+/// Copy a region of the display into a buffer
+/// - The buffer holds 2 bytes per pixel (uint16_t aligned) and
+///   requires the display MISO line for readback
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region to save (must be on-screen)
+/// \param[out] pvBuf:       Buffer to receive the pixel data
+/// \param[in]  nBufSize:    Size of pvBuf (in bytes)
+///
+/// \return true if success, false if the buffer is too small
+///
+bool gslc_DrvSaveRect(gslc_tsGui* pGui,gslc_tsRect rRect,void* pvBuf,uint32_t nBufSize);
+
+
+///
+/// Copy a region saved by gslc_DrvSaveRect() back to the display
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  rRect:       Display region that was saved
+/// \param[in]  pvBuf:       Buffer holding the pixel data
+///
+/// \return true if success, false if fail
+///
+bool gslc_DrvRestoreRect(gslc_tsGui* pGui,gslc_tsRect rRect,const void* pvBuf);
+
+
 // -----------------------------------------------------------------------
 // Touch Functions (if using display driver library)
 // -----------------------------------------------------------------------
@@ -213,21 +213,20 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
   sCheckbox##nElemId.bChecked = bChecked_;                        \
   sCheckbox##nElemId.colCheck = colCheck_;                        \
   sCheckbox##nElemId.nStyle = nStyle_;                            \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPEX_CHECKBOX,                                        \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       nGroup,                                                     \
-      GSLC_COL_GRAY,colFill,GSLC_COL_WHITE,GSLC_COL_BLACK, \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (GSLC_COL_GRAY),(colFill),(GSLC_COL_WHITE),(GSLC_COL_BLACK),\
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -236,8 +235,7 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
       NULL,                                                       \
       &gslc_ElemXCheckboxDraw,                                    \
       &gslc_ElemXCheckboxTouch,                                   \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -252,21 +250,20 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
   sCheckbox##nElemId.bChecked = bChecked_;                        \
   sCheckbox##nElemId.colCheck = colCheck_;                        \
   sCheckbox##nElemId.nStyle = nStyle_;                            \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPEX_CHECKBOX,                                        \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       nGroup,                                                     \
-      GSLC_COL_GRAY,colFill,GSLC_COL_WHITE,GSLC_COL_BLACK, \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (GSLC_COL_GRAY),(colFill),(GSLC_COL_WHITE),(GSLC_COL_BLACK),\
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -275,8 +272,7 @@ bool gslc_ElemXCheckboxTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int
       NULL,                                                       \
       &gslc_ElemXCheckboxDraw,                                    \
       &gslc_ElemXCheckboxTouch,                                   \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
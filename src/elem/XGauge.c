@@ -411,10 +411,14 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
   //  nMin,nMax,nRng,pGauge->nGaugeVal,fScl,nGaugeMid,rGauge.x,rGauge.w);
   #endif
 
+  // Resolve the element colors (including any shared style)
+  gslc_tsColor colFrame = gslc_ElemGetColFrame(pGui,pElem,false);
+  gslc_tsColor colFill  = gslc_ElemGetColFill(pGui,pElem,false);
+
   // Draw a frame around the gauge
   // - Only draw this during full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, colFrame);
   }
 
   // To avoid flicker, we only erase the portion of the gauge
@@ -426,23 +430,23 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
     nEmptyPos = (nGaugeY0 > nElemY1) ? nElemY1 : nGaugeY0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nElemX1-nElemX0+1,nEmptyPos-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,colFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeY1 < nElemY0) ? nElemY0 : nGaugeY1;
     rEmpty = (gslc_tsRect){nElemX0,nEmptyPos,nElemX1-nElemX0+1,nElemY1-nEmptyPos+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui,rTmp,pElem->colElemFill);
+    gslc_DrawFillRect(pGui,rTmp,colFill);
   } else {
     // Empty Region #1 (negative)
     nEmptyPos = (nGaugeX0 > nElemX1) ? nElemX1 : nGaugeX0;
     rEmpty = (gslc_tsRect){nElemX0,nElemY0,nEmptyPos-nElemX0+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, colFill);
     // Empty Region #2 (positive)
     nEmptyPos = (nGaugeX1 < nElemX0) ? nElemX0 : nGaugeX1;
     rEmpty = (gslc_tsRect){nEmptyPos,nElemY0,nElemX1-nEmptyPos+1,nElemY1-nElemY0+1};
     rTmp = gslc_ExpandRect(rEmpty,-1,-1);
-    gslc_DrawFillRect(pGui, rTmp, pElem->colElemFill);
+    gslc_DrawFillRect(pGui, rTmp, colFill);
   }
 
   // Draw the gauge fill region
@@ -454,11 +458,11 @@ bool gslc_ElemXGaugeDrawProgressBar(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gs
   // Draw the midpoint line
   if (bVert) {
     if (nElemY0 + nGaugeMid < nElemY1) {
-      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0, nElemY0 + nGaugeMid, nElemX1, nElemY0 + nGaugeMid, colFrame);
     }
   } else {
     if (nElemX0 + nGaugeMid < nElemX1) {
-      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, pElem->colElemFrame);
+      gslc_DrawLine(pGui, nElemX0 + nGaugeMid, nElemY0, nElemX0 + nGaugeMid, nElemY1, colFrame);
     }
   }
 
@@ -559,13 +563,13 @@ bool gslc_ElemXGaugeDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_te
 
   // Clear old
   if (bValLastValid) {
-    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
+    gslc_ElemXGaugeDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,gslc_ElemGetColFill(pGui,pElem,false));
   }
 
   // Draw frame
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFill);  // Erase first
-    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFrame);
+    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,gslc_ElemGetColFill(pGui,pElem,false));  // Erase first
+    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,gslc_ElemGetColFrame(pGui,pElem,false));
     for (nInd=0;nInd<360;nInd+=nTickAng) {
       gslc_DrawLinePolar(pGui,nElemMidX,nElemMidY,nElemRad-nTickLen,nElemRad,nInd*64,pGauge->colTick);
     }
@@ -651,6 +655,8 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
 
   nSclFX = (uint32_t)nElemH*32767/(nElemW*nElemW);
 
+  gslc_tsColor colFill = gslc_ElemGetColFill(pGui,pElem,false);
+
   for (nX=nPosXStart;nX<nPosXEnd;nX++) {
     nInd = nElemW-nX;
     nHeightTmp = nSclFX * nInd*nInd /32767;
@@ -683,13 +689,13 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       } else {
         // Inside gap
         // - No draw
-        nCol = pElem->colElemFill;
+        nCol = colFill;
       }
 
     }
 
     if (bModeErase) {
-      nCol = pElem->colElemFill;
+      nCol = colFill;
     }
     gslc_DrawLine(pGui,nElemX0+nX,nElemY1-nHeightBot,nElemX0+nX,nElemY1-nHeight,nCol);
 
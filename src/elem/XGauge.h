@@ -306,21 +306,20 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPEX_GAUGE,                                           \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -329,8 +328,7 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       NULL,                                                       \
       &gslc_ElemXGaugeDraw,                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -357,21 +355,20 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
   sGauge##nElemId.nIndicLen = 10;                                 \
   sGauge##nElemId.nIndicTip = 3;                                  \
   sGauge##nElemId.bIndicFill = false;                             \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
       GSLC_TYPEX_GAUGE,                                           \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
@@ -380,8 +377,7 @@ bool gslc_ElemXGaugeDrawRamp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRe
       NULL,                                                       \
       &gslc_ElemXGaugeDraw,                                       \
       NULL,                                                       \
-      NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
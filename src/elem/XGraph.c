@@ -291,7 +291,7 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,gslc_ElemGetColFrame(pGui,pElem,false));
     }
   }
 
@@ -300,7 +300,7 @@ bool gslc_ElemXGraphDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   //       erase the inner region. Instead we would just erase
   //       old values and redraw new ones
   gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem,-1,-1);
-  gslc_DrawFillRect(pGui,rInner,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+  gslc_DrawFillRect(pGui,rInner,gslc_ElemGetColFill(pGui,pElem,bGlow));
 
   int16_t           nDataVal;
   uint16_t          nCurX = 0;
@@ -328,6 +328,7 @@ gslc_tsElemRef* gslc_XKeyPadCreateBase(gslc_tsGui* pGui, int16_t nElemId, int16_
   sElem = gslc_ElemCreate(pGui, nElemId, nPage, GSLC_TYPEX_KEYPAD, rElem, NULL, 0, GSLC_FONT_NONE);
   sElem.nFeatures |= GSLC_ELEM_FEA_FRAME_EN;
   sElem.nFeatures |= GSLC_ELEM_FEA_FILL_EN;
+  sElem.nFeatures |= GSLC_ELEM_FEA_OPAQUE;    // Full redraw always fills the keypad rect
   sElem.nFeatures |= GSLC_ELEM_FEA_CLICK_EN;
   sElem.nFeatures &= ~GSLC_ELEM_FEA_GLOW_EN;  // Don't need to glow outer element
   sElem.nFeatures |= GSLC_ELEM_FEA_FOCUS_EN;
@@ -1411,6 +1412,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     //   margin on the left side
     nTxtLen = nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr,nTxtLen+1);
+    gslc_ElemTxtCacheReset(pGui,&sElemRef);
   
     gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
     nTxtPosX += nMarginX; // Account for margin once at start
@@ -1423,6 +1425,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     // Part 2: the cursor
     nTxtLen = 1;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor,nTxtLen+1);
+    gslc_ElemTxtCacheReset(pGui,&sElemRef);
   
     gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
@@ -1434,6 +1437,7 @@ void gslc_XKeyPadDrawVirtualTxt(gslc_tsGui* pGui,gslc_tsRect rElem,gslc_tsXKeyPa
     // Part 3: text after cursor
     nTxtLen = strlen(acDispStr)-nDispPosCursor;
     gslc_StrCopy(pStrBuf,acDispStr+nDispPosCursor+1,nTxtLen+1);
+    gslc_ElemTxtCacheReset(pGui,&sElemRef);
   
     gslc_DrvGetTxtSize(pGui,pVirtualElem->pTxtFont,pStrBuf,pVirtualElem->eTxtFlags,&nTxtOffsetX,&nTxtOffsetY,&nTxtSzW,&nTxtSzH);
   
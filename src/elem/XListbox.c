@@ -675,8 +675,8 @@ bool gslc_ElemXListboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     bItemSel = (nItemInd == nItemCurSel) ? true : false;
 
     // Determine the color based on state
-    colFill = (bItemSel) ? pElem->colElemFillGlow : pElem->colElemFill;
-    colTxt = (bItemSel) ? pElem->colElemTextGlow : pElem->colElemText;
+    colFill = gslc_ElemGetColFill(pGui,pElem,bItemSel);
+    colTxt = gslc_ElemGetColTxt(pGui,pElem,bItemSel);
 
     bool bDoRedraw = false;
     if (eRedraw == GSLC_REDRAW_FULL) {
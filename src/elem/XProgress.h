@@ -218,31 +218,29 @@ bool gslc_ElemXProgressDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
   sGauge##nElemId.colGauge = colGauge_;                           \
   sGauge##nElemId.bVert = bVert_;                                 \
   sGauge##nElemId.bFlip = false;                                  \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_PROGRESS,                                           \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_PROGRESS,                                        \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
       (void*)(&sGauge##nElemId),                                  \
       NULL,                                                       \
-      &gslc_ElemXProgressDraw,                                       \
-      NULL,                                                       \
+      &gslc_ElemXProgressDraw,                                    \
       NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -262,31 +260,29 @@ bool gslc_ElemXProgressDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
   sGauge##nElemId.colGauge = colGauge_;                           \
   sGauge##nElemId.bVert = bVert_;                                 \
   sGauge##nElemId.bFlip = false;                                  \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_PROGRESS,                                           \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_PROGRESS,                                        \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
       (void*)(&sGauge##nElemId),                                  \
       NULL,                                                       \
-      &gslc_ElemXProgressDraw,                                       \
-      NULL,                                                       \
+      &gslc_ElemXProgressDraw,                                    \
       NULL,                                                       \
-  };                                                              \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -345,13 +345,13 @@ bool gslc_ElemXRadialDrawRadial(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_t
 
   // Clear old
   if (bValLastValid) {
-    gslc_ElemXRadialDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,pElem->colElemFill);
+    gslc_ElemXRadialDrawRadialHelp(pGui,nElemMidX,nElemMidY,nArrowLen,nArrowSize,n64AngLast,bFill,gslc_ElemGetColFill(pGui,pElem,false));
   }
 
   // Draw frame
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFill);  // Erase first
-    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,pElem->colElemFrame);
+    gslc_DrawFillCircle(pGui,nElemMidX,nElemMidY,nElemRad,gslc_ElemGetColFill(pGui,pElem,false));  // Erase first
+    gslc_DrawFrameCircle(pGui,nElemMidX,nElemMidY,nElemRad,gslc_ElemGetColFrame(pGui,pElem,false));
     for (nInd=0;nInd<360;nInd+=nTickAng) {
       gslc_DrawLinePolar(pGui,nElemMidX,nElemMidY,nElemRad-nTickLen,nElemRad,nInd*64,pGauge->colTick);
     }
@@ -255,6 +255,8 @@ bool gslc_ElemXRampDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRed
 
   nSclFX = (uint32_t)nElemH*32767/(nElemW*nElemW);
 
+  gslc_tsColor colFill = gslc_ElemGetColFill(pGui,pElem,false);
+
   for (nX=nPosXStart;nX<nPosXEnd;nX++) {
     nInd = nElemW-nX;
     nHeightTmp = nSclFX * nInd*nInd /32767;
@@ -287,13 +289,13 @@ bool gslc_ElemXRampDrawHelp(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_teRed
       } else {
         // Inside gap
         // - No draw
-        nCol = pElem->colElemFill;
+        nCol = colFill;
       }
 
     }
 
     if (bModeErase) {
-      nCol = pElem->colElemFill;
+      nCol = colFill;
     }
     gslc_DrawLine(pGui,nElemX0+nX,nElemY1-nHeightBot,nElemX0+nX,nElemY1-nHeight,nCol);
 
@@ -180,7 +180,7 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
   gslc_tsColor colRingActive2 = pXRingGauge->colRing2;
   gslc_tsColor colRingInactive = pXRingGauge->colRingRemain;
   bool bGradient = pXRingGauge->bGradient;
-  gslc_tsColor colBg = pElem->colElemFill; // Background color used for text clearance
+  gslc_tsColor colBg = gslc_ElemGetColFill(pGui,pElem,false); // Background color used for text clearance
 
   // Calculate the ring center and radius
   int16_t nMidX = nElemX + nElemW / 2;
@@ -264,7 +264,7 @@ bool gslc_ElemXRingGaugeDraw(void* pvGui, void* pvElemRef, gslc_teRedrawType eRe
 
   // Draw text string if defined
   if (pElem->pStrBuf) {
-    gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
+    gslc_tsColor  colTxt    = gslc_ElemGetColTxt(pGui,pElem,bGlowNow);
     int8_t        nMarginX  = pElem->nTxtMarginX;
     int8_t        nMarginY  = pElem->nTxtMarginY;
 
@@ -325,7 +325,7 @@ bool gslc_ElemXSeekbarDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   //         then redraw other portions. This would prevent the
   //         track / ticks from flickering needlessly. A full redraw would
   //         be required if it was first draw action.
-  gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+  gslc_DrawFillRect(pGui,pElem->rElem,gslc_ElemGetColFill(pGui,pElem,bGlow));
   
   // Draw the progress part of track
   if (!bVert) {
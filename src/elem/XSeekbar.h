@@ -250,31 +250,29 @@ bool gslc_ElemXSeekbarTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int1
   sSeekbar##nElemId.colThumb = colThumb_;                          \
   sSeekbar##nElemId.nPos = nPos_;                                  \
   sSeekbar##nElemId.pfuncXPos = NULL;                              \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_SEEKBAR,                                          \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_SEEKBAR,                                         \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
-      (void*)(&sSeekbar##nElemId),                                 \
-      NULL,                                                       \
-      &gslc_ElemXSeekbarDraw,                                      \
-      &gslc_ElemXSeekbarTouch,                                     \
+      (void*)(&sSeekbar##nElemId),                                \
       NULL,                                                       \
-  };                                                              \
+      &gslc_ElemXSeekbarDraw,                                     \
+      &gslc_ElemXSeekbarTouch,                                    \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -298,31 +296,29 @@ bool gslc_ElemXSeekbarTouch(void* pvGui,void* pvElemRef,gslc_teTouch eTouch,int1
   sSeekbar##nElemId.colThumb = colThumb_;                          \
   sSeekbar##nElemId.nPos = nPos_;                                  \
   sSeekbar##nElemId.pfuncXPos = NULL;                              \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_SEEKBAR,                                          \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_SEEKBAR,                                         \
+      nX,nY,nW,nH,                                                \
       GSLC_GROUP_ID_NONE,                                         \
-      colFrame_,colFill_,colFrame_,colFill_,                      \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      (gslc_tsImgRef){NULL,NULL,GSLC_IMGREF_NONE,NULL},           \
-      NULL,                                                       \
+      (colFrame_),(colFill_),(colFrame_),(colFill_),              \
+      GSLC_IMGREF_INIT_NONE,                                      \
+      GSLC_IMGREF_INIT_NONE,                                      \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
-      (void*)(&sSeekbar##nElemId),                                 \
-      NULL,                                                       \
-      &gslc_ElemXSeekbarDraw,                                      \
-      &gslc_ElemXSeekbarTouch,                                     \
+      (void*)(&sSeekbar##nElemId),                                \
       NULL,                                                       \
-  };                                                              \
+      &gslc_ElemXSeekbarDraw,                                     \
+      &gslc_ElemXSeekbarTouch,                                    \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_CONST | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
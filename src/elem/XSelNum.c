@@ -236,7 +236,7 @@ bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // Draw the compound element fill (background)
   // - Should only need to do this in full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+    gslc_DrawFillRect(pGui,pElem->rElem,gslc_ElemGetColFill(pGui,pElem,bGlow));
   }
 
   // Draw the sub-elements
@@ -252,7 +252,7 @@ bool gslc_ElemXSelNumDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
   // - We don't need to show any glowing of the compound element
 
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? pElem->colElemFrameGlow : pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, gslc_ElemGetColFrame(pGui,pElem,bGlow));
   }
 
   // Clear the redraw flag
@@ -321,12 +321,12 @@ bool gslc_ElemXSpinnerDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Draw the element fill (background)
   // - Should only need to do this in full redraw
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFillRect(pGui,pElem->rElem,(bGlow)?pElem->colElemFillGlow:pElem->colElemFill);
+    gslc_DrawFillRect(pGui,pElem->rElem,gslc_ElemGetColFill(pGui,pElem,bGlow));
   }
 
   // Optionally, draw a frame around the element
   if (eRedraw == GSLC_REDRAW_FULL) {
-    gslc_DrawFrameRect(pGui, pElem->rElem, (bGlow) ? pElem->colElemFrameGlow : pElem->colElemFrame);
+    gslc_DrawFrameRect(pGui, pElem->rElem, gslc_ElemGetColFrame(pGui,pElem,bGlow));
   }
 
   // draw our virtual elements
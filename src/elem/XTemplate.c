@@ -185,9 +185,9 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   // - This also changes the fill color if selected and glow state is enabled
   if (pElem->nFeatures & GSLC_ELEM_FEA_FILL_EN) {
     if (bGlowEn && bGlowing) {
-      colBg = pElem->colElemFillGlow;
+      colBg = gslc_ElemGetColFill(pGui,pElem,true);
     } else {
-      colBg = pElem->colElemFill;
+      colBg = gslc_ElemGetColFill(pGui,pElem,false);
     }
     if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) {
       gslc_DrawFillRoundRect(pGui, rElemInner, pGui->nRoundRadius, colBg);
@@ -206,9 +206,9 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
   // Frame the region
   if (pElem->nFeatures & GSLC_ELEM_FEA_FRAME_EN) {
     if (pElem->nFeatures & GSLC_ELEM_FEA_ROUND_EN) {
-      gslc_DrawFrameRoundRect(pGui, pElem->rElem, pGui->nRoundRadius, pElem->colElemFrame);
+      gslc_DrawFrameRoundRect(pGui, pElem->rElem, pGui->nRoundRadius, gslc_ElemGetColFrame(pGui,pElem,false));
     } else {
-      gslc_DrawFrameRect(pGui, pElem->rElem, pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui, pElem->rElem, gslc_ElemGetColFrame(pGui,pElem,false));
     }
   }
 
@@ -218,7 +218,7 @@ bool gslc_ElemXTemplateDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedra
 
   // Draw text string if defined
   if (pElem->pStrBuf) {
-    gslc_tsColor  colTxt    = (bGlowNow)? pElem->colElemTextGlow : pElem->colElemText;
+    gslc_tsColor  colTxt    = gslc_ElemGetColTxt(pGui,pElem,bGlowNow);
     int8_t        nMarginX  = pElem->nTxtMarginX;
     int8_t        nMarginY  = pElem->nTxtMarginY;
 
@@ -102,6 +102,8 @@ gslc_tsElemRef* gslc_ElemXTextboxCreate(gslc_tsGui* pGui,int16_t nElemId,int16_t
   pXData->nWndRowStart    = 0;
 
   pXData->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+  pXData->nRedrawScroll = 0;
+  pXData->asSpanRow = NULL;
 
   // Clear the buffer
   memset(pBuf,0,nBufRows*nBufCols*sizeof(char));
@@ -189,9 +191,17 @@ void gslc_ElemXTextboxReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   // Clear the buffer
   memset(pBox->pBuf,0,pBox->nBufRows*pBox->nBufCols*sizeof(char));
 
+  // Invalidate any cached color spans
+  if (pBox->asSpanRow != NULL) {
+    for (uint16_t nRow=0;nRow<pBox->nBufRows;nRow++) {
+      pBox->asSpanRow[nRow].nSpanCnt = XTEXTBOX_SPAN_NONE;
+    }
+  }
+
   // Set the redraw flag
   // - Only need incremental redraw
   pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL; // All-row update
+  pBox->nRedrawScroll = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
 }
 
@@ -219,8 +229,18 @@ void gslc_ElemXTextboxLineWrAdv(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
   if (pBox->nBufPosY == pBox->nWndRowStart) {
     // Advance the window (with wrap if needed)
     pBox->nWndRowStart = (pBox->nWndRowStart + 1) % pBox->nBufRows;
+#if (DRV_HAS_COPY_RECT)
+    // Shift the rows already on the display during the next redraw
+    // rather than redrawing them all
+    if ((pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL) && (pBox->nRedrawScroll < pBox->nWndRows)) {
+      pBox->nRedrawScroll++;
+    } else {
+      pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+    }
+#else
     // Ensure all rows get redrawn
     pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+#endif
     gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
   }
 }
@@ -288,6 +308,11 @@ void gslc_ElemXTextboxBufAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned
   // Add the character
   pBox->pBuf[nBufPos] = chNew;
 
+  // Invalidate any cached color spans for the row
+  if (pBox->asSpanRow != NULL) {
+    pBox->asSpanRow[pBox->nBufPosY].nSpanCnt = XTEXTBOX_SPAN_NONE;
+  }
+
   // Only trigger redraw if we have output a printable character
   // to the display buffer. For simplicity, just check for
   // null for now.
@@ -306,13 +331,15 @@ void gslc_ElemXTextboxBufAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,unsigned
     }
     else {
       // Single row redraw was pending
-      if (pBox->nRedrawRow != pBox->nBufPosY) {
+      if ((pBox->nRedrawRow != pBox->nBufPosY) && (pBox->nRedrawScroll == 0)) {
         // But the pending row differs from the current row,
         // so promote redraw to all lines
         pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
       }
       else {
         // Pending row is the same, so no change
+        // - If a scroll is pending then the pending row marks the
+        //   first of the rows written since the last redraw
       }
     }
   } // chNew
@@ -371,6 +398,34 @@ void gslc_ElemXTextboxColReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef)
 #endif
 }
 
+void gslc_ElemXTextboxSpanBufSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsXTextboxSpanRow* asSpanRow,uint16_t nSpanRowMax)
+{
+#if (GSLC_FEATURE_XTEXTBOX_EMBED == 0)
+  (void)pGui; // Unused
+  (void)pElemRef; // Unused
+  (void)asSpanRow; // Unused
+  (void)nSpanRowMax; // Unused
+  GSLC_DEBUG2_PRINT("ERROR: gslc_ElemXTextboxSpanBufSet() not enabled. Requires GSLC_FEATURE_XTEXTBOX_EMBED=1 %s\n","");
+  return;
+#else
+  gslc_tsXTextbox*  pBox = NULL;
+  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
+  pBox = (gslc_tsXTextbox*)(pElem->pXData);
+
+  // The cache requires an entry for every row in the buffer
+  if ((asSpanRow != NULL) && (nSpanRowMax < pBox->nBufRows)) {
+    GSLC_DEBUG2_PRINT("ERROR: gslc_ElemXTextboxSpanBufSet() not enough rows [Max=%u Rows=%u]\n",nSpanRowMax,pBox->nBufRows);
+    return;
+  }
+  pBox->asSpanRow = asSpanRow;
+  if (asSpanRow != NULL) {
+    for (uint16_t nRow=0;nRow<pBox->nBufRows;nRow++) {
+      asSpanRow[nRow].nSpanCnt = XTEXTBOX_SPAN_NONE;
+    }
+  }
+#endif
+}
+
 void gslc_ElemXTextboxWrapSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bWrapEn)
 {
   gslc_tsXTextbox*  pBox = NULL;
@@ -383,19 +438,6 @@ void gslc_ElemXTextboxWrapSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,bool bWr
 void gslc_ElemXTextboxAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pTxt)
 {
 
-  // Warn the user about mode compatibility
-#if (GSLC_FEATURE_XTEXTBOX_EMBED)
-  gslc_tsElem*      pElem = gslc_GetElemFromRef(pGui,pElemRef);
-  //gslc_tsXTextbox* pBox = (gslc_tsXTextbox*)(pElem->pXData);
-  static bool bWarned = false;  // Warn only once
-  bool bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
-  if ((!bWarned) && (bEncUtf8)) {
-    // Continue to render the text, but issue warning to the user
-    GSLC_DEBUG2_PRINT("WARNING: ElemXTextboxAdd(%s) UTF-8 encoding not supported in GSLC_FEATURE_XTEXTBOX_EMBED=1 mode\n","");
-    bWarned = true;
-  }
-#endif
-
   // Add null-terminated string to the bottom of the buffer
   // If the string exceeds the buffer length then it will wrap
   // back to the beginning.
@@ -438,6 +480,218 @@ void gslc_ElemXTextboxAdd(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,char* pTxt)
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_INC);
 }
 
+// Determine whether a row in the window needs to be drawn
+// during an incremental redraw
+static bool gslc_ElemXTextboxRowPending(gslc_tsXTextbox* pBox,uint16_t nRowCur,uint8_t nOutRow,uint8_t nMaxRow)
+{
+  if (pBox->nRedrawScroll == 0) {
+    // Either all rows or only the single pending row
+    return ((pBox->nRedrawRow < 0) || (pBox->nRedrawRow == (int16_t)nRowCur));
+  }
+  // Rows exposed by the scroll were cleared, so draw them in full
+  if (nOutRow + pBox->nRedrawScroll >= nMaxRow) {
+    return true;
+  }
+  if (pBox->nRedrawRow < 0) {
+    return false;
+  }
+  // Rows written since the last redraw run from the pending row
+  // up to the current write row (with buffer wrap)
+  uint16_t nRunLen = (pBox->nBufPosY + pBox->nBufRows - pBox->nRedrawRow) % pBox->nBufRows;
+  uint16_t nRunOfs = (nRowCur + pBox->nBufRows - pBox->nRedrawRow) % pBox->nBufRows;
+  return (nRunOfs <= nRunLen);
+}
+
+#if (DRV_HAS_COPY_RECT)
+// Shift the rows on the display up by the pending scroll amount
+// and clear the rows that were exposed at the bottom
+// - Returns false if the rows can't be shifted, in which case
+//   all rows need to be redrawn
+static bool gslc_ElemXTextboxScrollBlit(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXTextbox* pBox,gslc_tsColor colBg)
+{
+  uint8_t nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
+  if (pBox->nRedrawScroll >= nMaxRow) {
+    return false;
+  }
+
+  // Region covered by the rows of text
+  // - This must lie within the frame and the current clip region
+  //   since the copy would otherwise pick up pixels from outside
+  gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
+  gslc_tsRect rClip = gslc_GetClipRect(pGui);
+  gslc_tsRect rRows = (gslc_tsRect){rInner.x,(int16_t)(pElem->rElem.y + pBox->nMarginY),
+    rInner.w,(uint16_t)(nMaxRow * pBox->nChSizeY)};
+  gslc_tsRect rTest = rRows;
+  if ((!gslc_ClipRect(&rInner,&rTest)) || (!gslc_ClipRect(&rClip,&rTest))) {
+    return false;
+  }
+  if ((rTest.x != rRows.x) || (rTest.y != rRows.y) || (rTest.w != rRows.w) || (rTest.h != rRows.h)) {
+    return false;
+  }
+
+  uint16_t    nShiftY = pBox->nRedrawScroll * pBox->nChSizeY;
+  gslc_tsRect rSrc = (gslc_tsRect){rRows.x,(int16_t)(rRows.y + nShiftY),rRows.w,(uint16_t)(rRows.h - nShiftY)};
+  gslc_tsRect rExposed = (gslc_tsRect){rRows.x,(int16_t)(rRows.y + rSrc.h),rRows.w,nShiftY};
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_COPY_RECT);
+  if (!gslc_DrvCopyRect(pGui,rSrc,rRows.x,rRows.y)) {
+    return false;
+  }
+  gslc_DrawFillRect(pGui,rExposed,colBg);
+  return true;
+}
+#endif // DRV_HAS_COPY_RECT
+
+#if (GSLC_FEATURE_XTEXTBOX_EMBED)
+// Position while walking the color spans of a row
+typedef struct {
+  uint16_t  nPos;       // Byte offset of the next character
+  uint16_t  nCol;       // Display column of the next character
+  int16_t   nColCode;   // Byte offset of the color code in effect
+} gslc_tsXTextboxSpanIter;
+
+// Fetch the next run of same-color characters in a row
+// - Color codes are only recognized between characters, so that
+//   UTF-8 continuation bytes with the same values remain text
+// - Returns false at the end of the row or the window width
+static bool gslc_ElemXTextboxSpanNext(gslc_tsXTextbox* pBox,const char* pRow,bool bEncUtf8,
+  gslc_tsXTextboxSpanIter* pIter,gslc_tsXTextboxSpan* pSpan)
+{
+  // The last column is always left for the row terminator
+  uint16_t      nPosMax = pBox->nBufCols - 1;
+  unsigned char chNext;
+  uint8_t       nExtra;
+
+  // Step over any color codes ahead of the span
+  while (pIter->nPos < nPosMax) {
+    chNext = (unsigned char)pRow[pIter->nPos];
+    if (chNext == GSLC_XTEXTBOX_CODE_COL_SET) {
+      pIter->nColCode = pIter->nPos;
+      pIter->nPos += 4;
+    } else if (chNext == GSLC_XTEXTBOX_CODE_COL_RESET) {
+      pIter->nColCode = pIter->nPos;
+      pIter->nPos += 1;
+    } else {
+      break;
+    }
+  }
+  if ((pIter->nPos >= nPosMax) || (pRow[pIter->nPos] == 0) || (pIter->nCol >= pBox->nWndCols)) {
+    return false;
+  }
+
+  pSpan->nStart   = pIter->nPos;
+  pSpan->nCol     = pIter->nCol;
+  pSpan->nColCode = pIter->nColCode;
+
+  // Extend the span a character at a time
+  while ((pIter->nPos < nPosMax) && (pIter->nCol < pBox->nWndCols)) {
+    chNext = (unsigned char)pRow[pIter->nPos];
+    if ((chNext == 0) || (chNext == GSLC_XTEXTBOX_CODE_COL_SET) || (chNext == GSLC_XTEXTBOX_CODE_COL_RESET)) {
+      break;
+    }
+    pIter->nPos++;
+    pIter->nCol++;
+    if ((bEncUtf8) && (chNext >= 0xC0)) {
+      // Include the continuation bytes of a multi-byte character
+      nExtra = (chNext >= 0xF0)? 3 : (chNext >= 0xE0)? 2 : 1;
+      while ((nExtra > 0) && (pIter->nPos < nPosMax) && (((unsigned char)pRow[pIter->nPos] & 0xC0) == 0x80)) {
+        pIter->nPos++;
+        nExtra--;
+      }
+    }
+  }
+  pSpan->nLen = pIter->nPos - pSpan->nStart;
+  return true;
+}
+
+// Determine the text color selected by a color code in a row
+static gslc_tsColor gslc_ElemXTextboxSpanCol(gslc_tsGui* pGui,gslc_tsElem* pElem,const char* pRow,int16_t nColCode,gslc_tsColor colEntry)
+{
+  gslc_tsColor colTxt = colEntry;
+  if (nColCode == XTEXTBOX_COL_ENTRY) {
+    // No color code, so keep the color from the previous row
+  } else if ((unsigned char)pRow[nColCode] == GSLC_XTEXTBOX_CODE_COL_RESET) {
+    colTxt = gslc_ElemGetColTxt(pGui,pElem,false);
+  } else {
+    colTxt.r = (uint8_t)pRow[nColCode+1];
+    colTxt.g = (uint8_t)pRow[nColCode+2];
+    colTxt.b = (uint8_t)pRow[nColCode+3];
+  }
+  return colTxt;
+}
+
+// Draw a single color span
+static void gslc_ElemXTextboxDrawSpan(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXTextbox* pBox,char* pRow,
+  gslc_tsXTextboxSpan* pSpan,uint8_t nOutRow,gslc_tsColor colTxt,gslc_tsColor colBg)
+{
+  uint16_t nTxtPixX = pElem->rElem.x + pBox->nMarginX + pSpan->nCol * pBox->nChSizeX;
+  uint16_t nTxtPixY = pElem->rElem.y + pBox->nMarginY + nOutRow * pBox->nChSizeY;
+
+  // Temporarily terminate the span within the row buffer
+  char* pEnd  = &(pRow[pSpan->nStart + pSpan->nLen]);
+  char  chEnd = *pEnd;
+  *pEnd = 0;
+#if (DRV_OVERRIDE_TXT_ALIGN)
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
+  gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
+    &(pRow[pSpan->nStart]),pElem->eTxtFlags,colTxt,colBg);
+#else
+  GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
+  gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,pElem->pTxtFont,&(pRow[pSpan->nStart]),pElem->eTxtFlags,colTxt,colBg);
+#endif
+  *pEnd = chEnd;
+}
+
+// Draw a row in embedded color mode
+// - pColTxt provides the color at the start of the row and returns
+//   the color in effect at the end of the row
+// - If bDraw is false then only the color is advanced
+// - The row's spans are cached if a span buffer has been assigned
+static void gslc_ElemXTextboxDrawRow(gslc_tsGui* pGui,gslc_tsElem* pElem,gslc_tsXTextbox* pBox,uint16_t nRow,
+  uint8_t nOutRow,bool bDraw,gslc_tsColor* pColTxt,gslc_tsColor colBg)
+{
+  char*                   pRow = &(pBox->pBuf[nRow * pBox->nBufCols]);
+  bool                    bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
+  gslc_tsXTextboxSpanRow* pSpanRow = (pBox->asSpanRow)? &(pBox->asSpanRow[nRow]) : NULL;
+  gslc_tsXTextboxSpanIter sIter;
+  gslc_tsXTextboxSpan     sSpan;
+  gslc_tsColor            colEntry = *pColTxt;
+  uint8_t                 nSpanInd;
+
+  // Rebuild the cached spans if the row has changed
+  // - If the row has too many spans then it is left uncached
+  if ((pSpanRow != NULL) && (pSpanRow->nSpanCnt == XTEXTBOX_SPAN_NONE)) {
+    sIter = (gslc_tsXTextboxSpanIter){0,0,XTEXTBOX_COL_ENTRY};
+    nSpanInd = 0;
+    while ((nSpanInd < XTEXTBOX_SPAN_MAX) &&
+      (gslc_ElemXTextboxSpanNext(pBox,pRow,bEncUtf8,&sIter,&(pSpanRow->asSpan[nSpanInd])))) {
+      nSpanInd++;
+    }
+    if (!gslc_ElemXTextboxSpanNext(pBox,pRow,bEncUtf8,&sIter,&sSpan)) {
+      pSpanRow->nSpanCnt = nSpanInd;
+      pSpanRow->nColCode = sIter.nColCode;
+    }
+  }
+
+  if ((pSpanRow != NULL) && (pSpanRow->nSpanCnt != XTEXTBOX_SPAN_NONE)) {
+    for (nSpanInd=0;(bDraw)&&(nSpanInd<pSpanRow->nSpanCnt);nSpanInd++) {
+      gslc_tsXTextboxSpan* pSpan = &(pSpanRow->asSpan[nSpanInd]);
+      gslc_ElemXTextboxDrawSpan(pGui,pElem,pBox,pRow,pSpan,nOutRow,
+        gslc_ElemXTextboxSpanCol(pGui,pElem,pRow,pSpan->nColCode,colEntry),colBg);
+    }
+    *pColTxt = gslc_ElemXTextboxSpanCol(pGui,pElem,pRow,pSpanRow->nColCode,colEntry);
+  } else {
+    sIter = (gslc_tsXTextboxSpanIter){0,0,XTEXTBOX_COL_ENTRY};
+    while (gslc_ElemXTextboxSpanNext(pBox,pRow,bEncUtf8,&sIter,&sSpan)) {
+      if (bDraw) {
+        gslc_ElemXTextboxDrawSpan(pGui,pElem,pBox,pRow,&sSpan,nOutRow,
+          gslc_ElemXTextboxSpanCol(pGui,pElem,pRow,sSpan.nColCode,colEntry),colBg);
+      }
+    }
+    *pColTxt = gslc_ElemXTextboxSpanCol(pGui,pElem,pRow,sIter.nColCode,colEntry);
+  }
+}
+#endif // GSLC_FEATURE_XTEXTBOX_EMBED
+
 bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw)
 {
   if ((pvGui == NULL) || (pvElemRef == NULL)) {
@@ -464,7 +718,23 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // Draw the frame
   if (eRedraw == GSLC_REDRAW_FULL) {
     if (bFrameEn) {
-      gslc_DrawFrameRect(pGui,pElem->rElem,pElem->colElemFrame);
+      gslc_DrawFrameRect(pGui,pElem->rElem,gslc_ElemGetColFrame(pGui,pElem,false));
+    }
+  }
+
+  // Shift the rows on the display if the window has scrolled
+  // - Falls back to redrawing all rows if this isn't possible
+  if (pBox->nRedrawScroll > 0) {
+    bool bShifted = false;
+#if (DRV_HAS_COPY_RECT)
+    if ((eRedraw == GSLC_REDRAW_INC) && (pBox->nRedrawRow != XTEXTBOX_REDRAW_ALL)) {
+      bShifted = gslc_ElemXTextboxScrollBlit(pGui,pElem,pBox,
+        gslc_ElemGetColFill(pGui,pElem,bGlow));
+    }
+#endif
+    if (!bShifted) {
+      pBox->nRedrawRow = XTEXTBOX_REDRAW_ALL;
+      pBox->nRedrawScroll = 0;
     }
   }
 
@@ -472,24 +742,15 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
   // - Only do this if we need to redraw all rows
   if ((eRedraw == GSLC_REDRAW_FULL) || (pBox->nRedrawRow == XTEXTBOX_REDRAW_ALL)) {
     gslc_tsRect rInner = gslc_ExpandRect(pElem->rElem, -1, -1);
-    colBg = (bGlow) ? pElem->colElemFillGlow : pElem->colElemFill;
+    colBg = gslc_ElemGetColFill(pGui,pElem,bGlow);
     gslc_DrawFillRect(pGui, rInner, colBg);
   }
 
-  uint16_t          nBufPos = 0;
-
-  uint16_t          nTxtPixX;
-  uint16_t          nTxtPixY;
   gslc_tsColor      colTxt;
-  //bool            bEncUtf8;
   bool              bRedrawLine;
 
-  // Determine what encoding method is used for text
-  // Not used at the moment
-  //bEncUtf8 = ((pElem->eTxtFlags & GSLC_TXT_ENC) == GSLC_TXT_ENC_UTF8);
-
   // Initialize color state
-  colTxt = pElem->colElemText;
+  colTxt = gslc_ElemGetColTxt(pGui,pElem,false);
 
   // Calculate the starting row for the window
   uint16_t nWndRowStartScr = pBox->nWndRowStart;
@@ -502,9 +763,12 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 #if (GSLC_FEATURE_XTEXTBOX_EMBED == 0)
 
   // Normal mode support (no embedded text color)
-  // - This mode is much faster and is able to support UTF-8 text encoding
+  // - This mode is faster and is able to support UTF-8 text encoding
 
-  uint8_t nCurY = 0;
+  uint16_t nBufPos = 0;
+  uint16_t nTxtPixX;
+  uint16_t nTxtPixY;
+  uint8_t  nCurY = 0;
 
   uint8_t nOutRow = 0;
   uint8_t nMaxRow = 0;
@@ -523,8 +787,8 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     // row has been marked as requiring redraw, then skip
     // all other rows
     if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
+      if (!gslc_ElemXTextboxRowPending(pBox,nRowCur,nOutRow,nMaxRow)) {
+        // Row is unchanged on the display, so skip
         bRedrawLine = false;
       }
     }
@@ -541,9 +805,11 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
       nTxtPixX = pElem->rElem.x + pBox->nMarginX + 0 * pBox->nChSizeX;
       nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
 #if (DRV_OVERRIDE_TXT_ALIGN)
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
       gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
             (char*)&(pBox->pBuf[nBufPos]),pElem->eTxtFlags,colTxt,colBg);
 #else
+      GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_TEXT);
       gslc_DrvDrawTxt(pGui, nTxtPixX, nTxtPixY, pElem->pTxtFont, (char*)&(pBox->pBuf[nBufPos]), pElem->eTxtFlags, colTxt, colBg);
 #endif
     }
@@ -555,23 +821,13 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
 
   // Embedded color mode support
   // - This mode supports inline changing of text color
-  // - However, it does not support UTF-8 character encoding
-  // - It is also slower since rendering is per-character
-
-  enum              {TBOX_NORM, TBOX_COL_SET};
-  int16_t           eTBoxState = TBOX_NORM;
-  uint16_t          nTBoxStateCnt = 0;
-
-  unsigned char     chNext;
-  uint8_t           nCurX = 0;
-  uint8_t           nCurY = 0;
+  // - Consecutive characters of the same color are drawn as a single
+  //   string, and the spans can be cached per row
+  // - Color codes are only recognized between characters, so UTF-8
+  //   character encoding is supported
 
   uint8_t nOutRow = 0;
-  uint8_t nOutCol = 0;
-  uint8_t nMaxCol = 0;
   uint8_t nMaxRow = 0;
-  bool    bRowDone = false;
-  nMaxCol = (pBox->nBufCols < pBox->nWndCols)? pBox->nBufCols : pBox->nWndCols;
   nMaxRow = (pBox->nBufRows < pBox->nWndRows)? pBox->nBufRows : pBox->nWndRows;
   for (nOutRow=0;nOutRow<nMaxRow;nOutRow++) {
 
@@ -586,80 +842,22 @@ bool gslc_ElemXTextboxDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eRedraw
     // row has been marked as requiring redraw, then skip
     // all other rows
     if (eRedraw == GSLC_REDRAW_INC) {
-      if ((pBox->nRedrawRow >= 0) && (pBox->nRedrawRow != nRowCur)) {
-        // Single-row redraw, but we are not on that row, so skip
+      if (!gslc_ElemXTextboxRowPending(pBox,nRowCur,nOutRow,nMaxRow)) {
+        // Row is unchanged on the display, so skip
         bRedrawLine = false;
       }
     }
 
-    bRowDone = false;
-    nCurX = 0;
-    for (nOutCol=0;(!bRowDone)&&(bRedrawLine)&&(nOutCol<nMaxCol);nOutCol++) {
-
-
-
-
-
-      // NOTE: At the start of buffer fill where we have
-      // only written a couple rows, we don't stop reading
-      // across all of the rows. We are dependent upon
-      // the reset to initialize all rows with NULL terminator
-      // so that we don't show garbage.
-
-      nBufPos = nRowCur * pBox->nBufCols + nOutCol;
-      chNext = pBox->pBuf[nBufPos];
-
-      if (eTBoxState == TBOX_NORM) {
-        if (chNext == 0) {
-          // Reached early terminator
-          bRowDone = true;
-          continue;
-        } else if (chNext == GSLC_XTEXTBOX_CODE_COL_SET) {
-          // Set color (enter FSM)
-          eTBoxState = TBOX_COL_SET;
-          nTBoxStateCnt = 0;
-        } else if (chNext == GSLC_XTEXTBOX_CODE_COL_RESET) {
-          // Reset color
-          colTxt = pElem->colElemText;
-        } else {
-
-          // Render the character
-          // TODO: Optimize by coalescing all characters in row before calling DrvDrawTxt
-          //       - Note that this would make it harder to change aspects (such as color)
-          //         in mid-line.
-          char  acChToDraw[2] = "";
-          acChToDraw[0] = chNext;
-          acChToDraw[1] = 0;
-          nTxtPixX = pElem->rElem.x + pBox->nMarginX + nCurX * pBox->nChSizeX;
-          nTxtPixY = pElem->rElem.y + pBox->nMarginY + nCurY * pBox->nChSizeY;
-#if (DRV_OVERRIDE_TXT_ALIGN)
-          gslc_DrvDrawTxtAlign(pGui,nTxtPixX,nTxtPixY,nTxtPixX,nTxtPixY,GSLC_ALIGN_TOP_LEFT,pElem->pTxtFont,
-            (char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
-#else
-          gslc_DrvDrawTxt(pGui,nTxtPixX,nTxtPixY,pElem->pTxtFont,(char*)&acChToDraw,pElem->eTxtFlags,colTxt,colBg);
-#endif
-          nCurX++;
-
-        }
-
-      } else if (eTBoxState == TBOX_COL_SET) {
-        nTBoxStateCnt++;
-        if      (nTBoxStateCnt == 1) { colTxt.r = chNext; }
-        else if (nTBoxStateCnt == 2) { colTxt.g = chNext; }
-        else if (nTBoxStateCnt == 3) {
-          colTxt.b = chNext;
-          eTBoxState = TBOX_NORM;
-        }
-      } // eTBoxState
-
-    } // nOutCol
-    nCurY++;
+    // Skipped rows still advance the text color so that the rows
+    // that follow are drawn with the same color as in a full redraw
+    gslc_ElemXTextboxDrawRow(pGui,pElem,pBox,nRowCur,nOutRow,bRedrawLine,&colTxt,colBg);
   } // nOutRow
 
 #endif // GSLC_FEATURE_XTEXTBOX_EMBED
 
   // Clear the redraw flag
   pBox->nRedrawRow = XTEXTBOX_REDRAW_NONE;
+  pBox->nRedrawScroll = 0;
   gslc_ElemSetRedraw(pGui,pElemRef,GSLC_REDRAW_NONE);
    
   // Mark page as needing flip
@@ -57,10 +57,34 @@ extern "C" {
 #define XTEXTBOX_REDRAW_NONE   -1
 #define XTEXTBOX_REDRAW_ALL    -2
 
+/// Maximum number of color spans cached per row (GSLC_FEATURE_XTEXTBOX_EMBED)
+/// - Rows with more spans are still drawn but are re-parsed on each redraw
+#if !defined(XTEXTBOX_SPAN_MAX)
+  #define XTEXTBOX_SPAN_MAX    4
+#endif
+
+#define XTEXTBOX_SPAN_NONE     0xFF   ///< Row span cache entry is not valid
+#define XTEXTBOX_COL_ENTRY     -1     ///< Span color is inherited from the previous row
+
 // Extended element data structures
 // - These data structures are maintained in the gslc_tsElem
 //   structure via the pXData pointer
 
+/// Run of characters in a textbox row that share the same color
+typedef struct {
+  uint16_t                    nStart;       ///< Byte offset of the span within the row
+  uint16_t                    nLen;         ///< Length of the span (bytes)
+  uint16_t                    nCol;         ///< Display column of the first character
+  int16_t                     nColCode;     ///< Byte offset of the color code in effect (or XTEXTBOX_COL_ENTRY)
+} gslc_tsXTextboxSpan;
+
+/// Cached color spans for one textbox row
+typedef struct {
+  uint8_t                     nSpanCnt;     ///< Number of spans (or XTEXTBOX_SPAN_NONE if not cached)
+  int16_t                     nColCode;     ///< Byte offset of the last color code in the row (or XTEXTBOX_COL_ENTRY)
+  gslc_tsXTextboxSpan         asSpan[XTEXTBOX_SPAN_MAX]; ///< Spans in display order
+} gslc_tsXTextboxSpanRow;
+
 /// Extended data for Textbox element
 typedef struct {
   // Config
@@ -87,6 +111,9 @@ typedef struct {
   uint8_t                     nWndRowStart; ///< First row of current window
   // Redraw
   int16_t                     nRedrawRow;   ///< Specific row to update in redraw (if not -1)
+  uint8_t                     nRedrawScroll;///< Rows scrolled since last redraw (shifted by blit)
+  // Embedded color
+  gslc_tsXTextboxSpanRow*     asSpanRow;    ///< Optional color span cache with one entry per buffer row
 
 } gslc_tsXTextbox;
 
@@ -100,6 +127,8 @@ typedef struct {
 ///   display size (defined by rElem), then a scrollbar will be shown.
 /// - Support for changing color within a row can be enabled with GSLC_FEATURE_XTEXTBOX_EMBED 1
 /// - Note that each color change command will consume 4 of the available "column" bytes.
+/// - In embedded color mode, characters of the same color are drawn as a single
+///   string. The spans can be cached with gslc_ElemXTextboxSpanBufSet().
 ///
 /// \param[in]  pGui:        Pointer to GUI
 /// \param[in]  nElemId:     Element ID to assign (0..16383 or GSLC_ID_AUTO to autogen)
@@ -177,6 +206,22 @@ void gslc_ElemXTextboxColSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsCo
 ///
 void gslc_ElemXTextboxColReset(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef);
 
+///
+/// Assign a buffer to cache the color spans of each textbox row
+/// - Requires GSLC_FEATURE_XTEXTBOX_EMBED=1
+/// - Without a cache, the rows are re-parsed for color codes on each redraw
+/// - A row's spans are rebuilt only after text is written to the row
+///
+/// \param[in]  pGui:        Pointer to GUI
+/// \param[in]  pElemRef:    Pointer to Element reference
+/// \param[in]  asSpanRow:   Array of span cache entries (already allocated)
+///                          or NULL to disable the cache
+/// \param[in]  nSpanRowMax: Number of entries in asSpanRow (at least nBufRows)
+///
+/// \return none
+///
+void gslc_ElemXTextboxSpanBufSet(gslc_tsGui* pGui,gslc_tsElemRef* pElemRef,gslc_tsXTextboxSpanRow* asSpanRow,uint16_t nSpanRowMax);
+
 ///
 /// Enable or disable line wrap within textbox
 ///
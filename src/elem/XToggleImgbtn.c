@@ -284,10 +284,10 @@ bool gslc_ElemXToggleImgbtnDraw(void* pvGui,void* pvElemRef,gslc_teRedrawType eR
   // Draw any images associated with element
   int16_t nInnerX = sState.rInner.x;
   int16_t nInnerY = sState.rInner.y;
-  if (pToggleImgbtn->bOn) {
-    bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefNorm);
-  } else {
-    bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,pElem->sImgRefGlow);
+  gslc_tsImgRef* pImgRef = gslc_ElemGetImgRef(pGui,pElem,!pToggleImgbtn->bOn,false);
+  if (pImgRef != NULL) {
+    GSLC_STATS_DRV(pGui,GSLC_STAT_DRV_IMAGE);
+    bOk = gslc_DrvDrawImage(pGui,nInnerX,nInnerY,*pImgRef);
   }
 
   if (!bOk) {
@@ -190,31 +190,30 @@ gslc_tsElemRef* gslc_ElemXToggleImgbtnFindSelected(gslc_tsGui* pGui,int16_t nGro
   sToggleImgbtn##nElemId.bOn = bOn_;                            \
   sToggleImgbtn##nElemId.nMyPageId = nPage;                          \
   sToggleImgbtn##nElemId.pfunctUser = cbTouch;                       \
-  static const gslc_tsElem sElem##nElemId PROGMEM = {             \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_TOGGLEIMGBTN,                                       \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_TOGGLEIMGBTN,                                    \
+      nX,nY,nW,nH,                                                \
       -6999,                                                      \
-      GSLC_COL_GRAY,GSLC_COL_BLACK,GSLC_COL_WHITE,GSLC_COL_BLACK, \
-      sImgRef_,           \
-      sImgRefSel_,           \
-      NULL,                                                       \
+      (GSLC_COL_GRAY),(GSLC_COL_BLACK),                           \
+      (GSLC_COL_WHITE),(GSLC_COL_BLACK),                          \
+      (sImgRef_),                                                 \
+      (sImgRefSel_),                                              \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
-      (void*)(&sToggleImgbtn##nElemId),                              \
-      NULL,                                                       \
-      &gslc_ElemXToggleImgbtnDraw,                                   \
-      &gslc_ElemXToggleImgbtnTouch,                                  \
+      (void*)(&sToggleImgbtn##nElemId),                           \
       NULL,                                                       \
-  };                                                              \
+      &gslc_ElemXToggleImgbtnDraw,                                \
+      &gslc_ElemXToggleImgbtnTouch,                               \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 
@@ -228,31 +227,30 @@ gslc_tsElemRef* gslc_ElemXToggleImgbtnFindSelected(gslc_tsGui* pGui,int16_t nGro
   sToggleImgbtn##nElemId.bOn = bOn_;                            \
   sToggleImgbtn##nElemId.nMyPageId = nPage;                          \
   sToggleImgbtn##nElemId.pfunctUser = cbTouch;                       \
-  static const gslc_tsElem sElem##nElemId = {                     \
+  gslc_ElemDefine_P(sElem##nElemId,                               \
       nElemId,                                                    \
       nFeatures##nElemId,                                         \
-      GSLC_TYPEX_TOGGLEIMGBTN,                                       \
-      (gslc_tsRect){nX,nY,nW,nH},                                 \
+      GSLC_TYPEX_TOGGLEIMGBTN,                                    \
+      nX,nY,nW,nH,                                                \
       -6999,                                                      \
-      GSLC_COL_GRAY,GSLC_COL_BLACK,GSLC_COL_WHITE,GSLC_COL_BLACK, \
-      sImgRef_,           \
-      sImgRefSel_,           \
-      NULL,                                                       \
+      (GSLC_COL_GRAY),(GSLC_COL_BLACK),                           \
+      (GSLC_COL_WHITE),(GSLC_COL_BLACK),                          \
+      (sImgRef_),                                                 \
+      (sImgRefSel_),                                              \
       NULL,                                                       \
       0,                                                          \
       (gslc_teTxtFlags)(GSLC_TXT_DEFAULT),                        \
-      GSLC_COL_WHITE,                                             \
-      GSLC_COL_WHITE,                                             \
+      (GSLC_COL_WHITE),                                           \
+      (GSLC_COL_WHITE),                                           \
       GSLC_ALIGN_MID_MID,                                         \
       0,                                                          \
       0,                                                          \
       NULL,                                                       \
-      (void*)(&sToggleImgbtn##nElemId),                              \
-      NULL,                                                       \
-      &gslc_ElemXToggleImgbtnDraw,                                   \
-      &gslc_ElemXToggleImgbtnTouch,                                  \
+      (void*)(&sToggleImgbtn##nElemId),                           \
       NULL,                                                       \
-  };                                                              \
+      &gslc_ElemXToggleImgbtnDraw,                                \
+      &gslc_ElemXToggleImgbtnTouch,                               \
+      NULL);                                                      \
   gslc_ElemAdd(pGui,nPage,(gslc_tsElem*)&sElem##nElemId,          \
     (gslc_teElemRefFlags)(GSLC_ELEMREF_SRC_PROG | GSLC_ELEMREF_VISIBLE | GSLC_ELEMREF_REDRAW_FULL));
 